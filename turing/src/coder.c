@@ -341,7 +341,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x3322[22];
-typedef	Language___x3322	Language___x3321[255];
+typedef	Language___x3322	Language___x3321[256];
 extern Language___x3321	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -1698,7 +1698,7 @@ Language_Opcode	op;
 	TL_TLI_TLISS ((TLint4) Language_Compile_Coder_outFile, (TLint2) 2);
 	TL_TLI_TLIPN ((TLint4) 6, (TLnat4) Language_Compile_Coder_programCounter, (TLint2) Language_Compile_Coder_outFile);
 	TL_TLI_TLIPS ((TLint4) 0, ": ", (TLint2) Language_Compile_Coder_outFile);
-	TL_TLI_TLIPS ((TLint4) 0, (Language_OpcodeName[TLINRANGELOW(op, 0, 254, 1)]), (TLint2) Language_Compile_Coder_outFile);
+	TL_TLI_TLIPS ((TLint4) 0, (Language_OpcodeName[TLINRANGELOW(op, 0, 255, 1)]), (TLint2) Language_Compile_Coder_outFile);
 	TL_TLI_TLIPS ((TLint4) 0, " (", (TLint2) Language_Compile_Coder_outFile);
 	TL_TLI_TLIPN ((TLint4) 0, (TLnat4) (* (TLnat2 *) &op), (TLint2) Language_Compile_Coder_outFile);
 	TL_TLI_TLIPS ((TLint4) 0, ")", (TLint2) Language_Compile_Coder_outFile);
@@ -5477,6 +5477,8 @@ TLboolean	isBits;
     TLRESTORELF();
 }
 
+static void Language_Compile_Coder_CoerceForStringOperation ();
+
 void Language_Compile_Coder_OpAssign (op, isBits)
 Language_Compile_Tok	op;
 TLboolean	isBits;
@@ -5487,6 +5489,16 @@ TLboolean	isBits;
     if (op == 10) {
 	TLSETL(101895);
 	Language_Compile_Coder_CoerceToType(Language_Compile_Types_Second(), (Language_RangeCheckKind) 0);
+    } else if ((op == 24) && (! isBits) && ((Language_Compile_Types_SecondKind() == 27) || (Language_Compile_Types_SecondKind() == 28) || (Language_Compile_Types_SecondKind() == 29))) {
+	/* s += e appends in place (CATASN) rather than CAT into a temporary and ASNSTR back */
+	TLSETL(101897);
+	Language_Compile_Coder_CoerceForStringOperation();
+	TLINCL();
+	Language_Compile_Coder_PushStringSize(Language_Compile_Types_Second());
+	TLINCL();
+	Language_Compile_Coder_NoOperands((Language_Opcode) 255);
+	TLRESTORELF();
+	return;
     } else {
 	TLSETL(101897);
 	Language_Compile_Coder_Operator((Language_Compile_Tok) op);
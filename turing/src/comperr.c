@@ -330,7 +330,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x1986[22];
-typedef	Language___x1986	Language___x1985[255];
+typedef	Language___x1986	Language___x1985[256];
 extern Language___x1985	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -343,7 +343,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2792[22];
-typedef	Language___x2792	Language___x2791[255];
+typedef	Language___x2792	Language___x2791[256];
 extern Language___x2791	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
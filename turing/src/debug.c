@@ -322,7 +322,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x990[22];
-typedef	Language___x990	Language___x989[255];
+typedef	Language___x990	Language___x989[256];
 extern Language___x989	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
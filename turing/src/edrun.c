@@ -215,7 +215,7 @@ extern void	Language_Execute_RecoverAllMemory (void);
 
 extern int	MIOTime_GetTicks (void);
 extern char	Language_Execute_externalExecutionTimeoutFlag;
-extern TLint1	Language_Execute_fileMap[];
+extern TLVMSTATE TLint2	Language_Execute_fileMap[];
 
 /************************************************************************/
 /* EdRun_Init								*/
@@ -268,8 +268,12 @@ BOOL	EdRun_Init (void)
     stMainProgramFileNo = FLOATING_MAIN;
     
     // Initialize the MIO module
-    MIO_Initialize (gProgram.applicationInstance, OS_WINDOWS, myOOTPathName,
-    		    myHomePathName, FALSE, FALSE, SYSEXIT_ERROR_STRING);
+    if (!MIO_Initialize (gProgram.applicationInstance, OS_WINDOWS, 
+    			 myOOTPathName, myHomePathName, FALSE, FALSE, 
+    			 SYSEXIT_ERROR_STRING))
+    {
+    	return FALSE;
+    }
 
     //
     // Initialize Windows high resolution timer
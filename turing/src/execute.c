@@ -345,7 +345,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x1938[22];
-typedef	Language___x1938	Language___x1937[255];
+typedef	Language___x1938	Language___x1937[256];
 //extern Language___x1937	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -466,13 +466,13 @@ void Language_Execute_SetStep ();
 void Language_Execute_DumpThreadList ();
 
 void Language_Execute_UnitInitState ();
-TLint2	Language_Execute_executionTimeout;
+TLVMSTATE TLint2	Language_Execute_executionTimeout;
 TLboolean	Language_Execute_externalExecutionTimeoutFlag;
-TLint4	Language_Execute_stackAllocated;
-TLboolean	Language_Execute_allWaitingForKeyboard;
-TLboolean	Language_Execute_allWaitingForMouse;
-TLboolean	Language_Execute_allWaitingForDelay;
-TLint4	Language_Execute_minimumDelayCount;
+TLVMSTATE TLint4	Language_Execute_stackAllocated;
+TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
+TLVMSTATE TLboolean	Language_Execute_allWaitingForMouse;
+TLVMSTATE TLboolean	Language_Execute_allWaitingForDelay;
+TLVMSTATE TLint4	Language_Execute_minimumDelayCount;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -480,8 +480,8 @@ extern void TL_TLB_TLBUNI ();
 
 //extern char *strcpy ();
 typedef	TLint2	Language_Execute_ExecutionError_OverflowKind;
-static TLint4	Language_Execute_ExecutionError_savedQuitCode;
-static TLstring	Language_Execute_ExecutionError_savedMessage;
+static TLVMSTATE TLint4	Language_Execute_ExecutionError_savedQuitCode;
+static TLVMSTATE TLstring	Language_Execute_ExecutionError_savedMessage;
 
 void Language_Execute_ExecutionError_Abort (quitCode, message)
 TLint4	quitCode;
@@ -497,7 +497,7 @@ TLstring	message;
     TL_TLE_TLEQUIT ((TLint4) 2, (char *) 0, 0);
     TLRESTORELF();
 }
-static Language_Execute_ExecutionError_OverflowKind	Language_Execute_ExecutionError_overflowKind;
+static TLVMSTATE Language_Execute_ExecutionError_OverflowKind	Language_Execute_ExecutionError_overflowKind;
 
 void Language_Execute_ExecutionError_SetOverflowKind (kind)
 Language_Execute_ExecutionError_OverflowKind	kind;
@@ -645,10 +645,14 @@ void ExecutionError () {
 
 extern void Language_Execute_Heap_Alloc ();
 
+extern void Language_Execute_Heap_AllocStack ();
+
 extern void Language_Execute_Heap_CleanUp ();
 
 extern void Language_Execute_Heap_Dealloc ();
 
+extern void Language_Execute_Heap_DeallocStack ();
+
 extern void Language_Execute_Heap_Free ();
 
 extern void Language_Execute_Heap_New ();
@@ -781,14 +785,14 @@ extern TLboolean MIO_PlayDone ();
 extern void MIO_RegisterOpen ();
 
 extern void MIO_RegisterClose ();
-TLnat2	Language_Execute_numArguments;
-typedef	TLint1	Language_Execute___x1956[23];
-Language_Execute___x1956	Language_Execute_fileMap;
+TLVMSTATE TLnat2	Language_Execute_numArguments;
+typedef	TLint2	Language_Execute___x1956[TL_TLI_MAXSTREAM + 3];
+TLVMSTATE Language_Execute___x1956	Language_Execute_fileMap;
 typedef	Language_StringDef	*Language_Execute___x1959[21];
-Language_Execute___x1959	Language_Execute_argumentNames;
-static TLnat2	Language_Execute_numFilesOpen;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+TLVMSTATE Language_Execute___x1959	Language_Execute_argumentNames;
+static TLVMSTATE TLnat2	Language_Execute_numFilesOpen;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 
 extern void TL_TLI_TLIOF ();
 
@@ -838,7 +842,9 @@ struct	Language_Execute_ProcessDescriptor {
     TLnat4	waitParameter;
     struct Language_Execute_ConditionDescriptor	*waitCondition;
     struct Language_Execute_ProcessDescriptor	*nextTimeout;
+    struct Language_Execute_ProcessDescriptor	*prevTimeout;
     TLnat4	totalPause;
+    TLnat4	switches;
     struct Language_Execute_HandlerArea	*activeHandler;
     struct Language_Execute_HandlerArea	*runningHandler;
     Language_Step	stepSpec;
@@ -866,12 +872,12 @@ struct	Language_Execute_ConditionDefinition {
     TLaddressint	name;
     struct Language_Execute_ConditionDefinition	*nextVariable;
 };
-struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
-struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
-TLnat4	Language_Execute_Chrono;
-TLint4	Language_Execute_processCount;
-TLaddressint	Language_Execute_globalPC;
-TLaddressint	Language_Execute_globalSP;
+TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
+TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
+TLVMSTATE TLnat4	Language_Execute_Chrono;
+TLVMSTATE TLint4	Language_Execute_processCount;
+TLVMSTATE TLaddressint	Language_Execute_globalPC;
+TLVMSTATE TLaddressint	Language_Execute_globalSP;
 typedef	Language_Opcode	Language_Execute___x1961[1];
 Language_Execute___x1961	Language_Execute_nullRoutine = 
     {206};
@@ -984,14 +990,14 @@ TLint4 Language_Execute_GetStackAllocated () {
     /* NOTREACHED */
     TLFCNRESULTABORT;
 }
-static TLint4	Language_Execute_failedOpenStream;
+static TLVMSTATE TLint4	Language_Execute_failedOpenStream;
 struct	Language_Execute___x1968 {
     TLint4	streamNo;
     TLstring	msg;
     struct SrcPosition	srcPos;
 };
 typedef	struct Language_Execute___x1968	Language_Execute___x1967[10];
-static Language_Execute___x1967	Language_Execute_failedOpenInfo;
+static TLVMSTATE Language_Execute___x1967	Language_Execute_failedOpenInfo;
 
 void Language_Execute_AddFile (fnum, mode)
 TLint4	*fnum;
@@ -1025,7 +1031,7 @@ TLint4	mode;
 	return;
     };
     TLSETL(100340);
-    if ((Language_Execute_numArguments + Language_Execute_numFilesOpen) == 20) {
+    if ((Language_Execute_numArguments + Language_Execute_numFilesOpen) == TL_TLI_MAXSTREAM) {
 	TLSETL(100341);
 	TL_TLI_TLICL ((TLint4) (*fnum));
 	TLINCL();
@@ -1037,11 +1043,11 @@ TLint4	mode;
     TLSETL(100346);
     {
 	register TLint4	i;
-	for (i = Language_Execute_numArguments + 1; i <= 20; i++) {
+	for (i = Language_Execute_numArguments + 1; i <= TL_TLI_MAXSTREAM; i++) {
 	    TLSETL(100347);
-	    if ((Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)]) == -3) {
+	    if ((Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)]) == -3) {
 		TLSETL(100348);
-		Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)] = (*fnum);
+		Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)] = (*fnum);
 		TLINCL();
 		(*fnum) = i;
 		TLINCL();
@@ -1281,7 +1287,7 @@ register TLint4	fnum;
 	Language_Execute_BadStreamAbortMessage((TLint4) fnum, "Close");
     } else {
 	TLSETL(100455);
-	if (fnum > 20) {
+	if (fnum > TL_TLI_MAXSTREAM) {
 	    TLSETL(100458);
 	    {
 		TLstring	__x2006;
@@ -1294,7 +1300,7 @@ register TLint4	fnum;
 	    };
 	} else {
 	    TLSETL(100458);
-	    if ((Language_Execute_fileMap[TLINRANGELOW(fnum, -2, 20, 1)]) == -3) {
+	    if ((Language_Execute_fileMap[TLINRANGELOW(fnum, -2, TL_TLI_MAXSTREAM, 1)]) == -3) {
 		TLSETL(100461);
 		{
 		    TLstring	__x2008;
@@ -1309,10 +1315,10 @@ register TLint4	fnum;
 	};
     };
     TLSETL(100463);
-    TL_TLI_TLICL ((TLint4) (Language_Execute_fileMap[TLINRANGELOW(fnum, -2, 20, 1)]));
+    TL_TLI_TLICL ((TLint4) (Language_Execute_fileMap[TLINRANGELOW(fnum, -2, TL_TLI_MAXSTREAM, 1)]));
     TLSETL(100468);
     MIO_RegisterClose((TLint4) fnum);
-    Language_Execute_fileMap[TLINRANGELOW(fnum, -2, 20, 1)] = -3;
+    Language_Execute_fileMap[TLINRANGELOW(fnum, -2, TL_TLI_MAXSTREAM, 1)] = -3;
     TLSETL(100470);
     if (fnum > Language_Execute_numArguments) {
 	TLSETL(100471);
@@ -1343,14 +1349,14 @@ static void Language_Execute_CloseAllFiles () {
     TLSETL(100486);
     {
 	register TLint4	i;
-	for (i = 1; i <= 20; i++) {
+	for (i = 1; i <= TL_TLI_MAXSTREAM; i++) {
 	    TLSETL(100487);
-	    if ((Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)]) != -3) {
+	    if ((Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)]) != -3) {
 		TLSETL(100488);
-		TL_TLI_TLICL ((TLint4) (Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)]));
+		TL_TLI_TLICL ((TLint4) (Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)]));
 		TLSETL(100493);
 		MIO_RegisterClose((TLint4) i);
-		Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)] = -3;
+		Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)] = -3;
 	    };
 	};
     };
@@ -1367,7 +1373,7 @@ TLboolean	abort;
     TLSTKCHKSLF(100501);
     TLSETF();
     TLSETL(100501);
-    TLPRE (((TL_TLI_TLIXSN > 0) && (TL_TLI_TLIXSN <= Language_Execute_numArguments)) && ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)]) == -3));
+    TLPRE (((TL_TLI_TLIXSN > 0) && (TL_TLI_TLIXSN <= Language_Execute_numArguments)) && ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)]) == -3));
     TLSETL(100505);
     if ((Language_Execute_argumentNames[TLINRANGELOW(TL_TLI_TLIXSN, 0, 20, 1)]) == ((Language_StringDef *) 0)) {
 	TLSETL(100508);
@@ -1406,7 +1412,7 @@ TLboolean	abort;
 	};
     } else {
 	TLSETL(100522);
-	Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)] = f;
+	Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)] = f;
     };
     TLRESTORELF();
 }
@@ -1422,9 +1428,9 @@ TLint4	*stream;
     TLINCL();
     if ((*stream) != 0) {
 	TLSETL(100532);
-	if ((Language_Execute_fileMap[TLINRANGELOW((*stream), -2, 20, 1)]) != -3) {
+	if ((Language_Execute_fileMap[TLINRANGELOW((*stream), -2, TL_TLI_MAXSTREAM, 1)]) != -3) {
 	    TLSETL(100533);
-	    fd = Language_Execute_fileMap[TLINRANGELOW((*stream), -2, 20, 1)];
+	    fd = Language_Execute_fileMap[TLINRANGELOW((*stream), -2, TL_TLI_MAXSTREAM, 1)];
 	} else {
 	    TLSETL(100535);
 	    (*stream) = 0;
@@ -1438,8 +1444,8 @@ TLint4	*stream;
     };
     TLRESTORELF();
 }
-TLaddressint	Language_Execute_savedInitPC;
-TLaddressint	Language_Execute_savedInitFP;
+TLVMSTATE TLaddressint	Language_Execute_savedInitPC;
+TLVMSTATE TLaddressint	Language_Execute_savedInitFP;
 
 void Language_Execute_UnitInitState (pc, fp)
 TLaddressint	*pc;
@@ -1561,6 +1567,8 @@ extern void Language_Execute_Kernel_RunQueueInsert ();
 
 extern void Language_Execute_Kernel_SetProcessPriority ();
 
+extern void Language_Execute_Kernel_SetSlice ();
+
 extern void Language_Execute_Kernel_SignalDeferredCondition ();
 
 extern void Language_Execute_Kernel_SignalPriorityCondition ();
@@ -1603,7 +1611,7 @@ struct MIO_EventDescriptor	*event;
     TLSTKCHKSLF(100629);
     TLSETF();
     TLSETL(100629);
-    fileStream = Language_Execute_fileMap[TLINRANGELOW(stream, -2, 20, 1)];
+    fileStream = Language_Execute_fileMap[TLINRANGELOW(stream, -2, TL_TLI_MAXSTREAM, 1)];
     TLINCL();
     if (fileStream == -3) {
 	TLSETL(100632);
@@ -1844,7 +1852,7 @@ void Language_Execute_Open () {
 		    };
 		};
 		TLSETL(100766);
-		if ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)]) != -3) {
+		if ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)]) != -3) {
 		    TLSETL(100769);
 		    {
 			TLstring	__x2046;
@@ -1889,7 +1897,7 @@ void Language_Execute_Put () {
     TLINCL();
     Language_Execute_globalSP += 4;
     TLINCL();
-    stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)];
+    stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)];
     TLINCL();
     if (stream == -3) {
 	TLSETL(100789);
@@ -2140,7 +2148,7 @@ void Language_Execute_Get () {
     TLINCL();
     Language_Execute_globalSP += 4;
     TLINCL();
-    stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)];
+    stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)];
     TLINCL();
     if (stream == -3) {
 	TLSETL(100920);
@@ -2738,7 +2746,7 @@ Language_Opcode	op;
 		TLSETL(101194);
 		TL_TLI_TLIXSN = (* (TLint4 *) ((* (TLaddressint *) Language_Execute_globalSP)));
 		TLINCL();
-		stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)];
+		stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)];
 		TLINCL();
 		if (stream == -3) {
 		    TLSETL(101201);
@@ -2815,7 +2823,7 @@ Language_Opcode	op;
 		TLINCL();
 		Language_Execute_globalSP += 4;
 		TLINCL();
-		stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)];
+		stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)];
 		TLINCL();
 		if (stream == -3) {
 		    TLSETL(101246);
@@ -2916,7 +2924,7 @@ Language_Opcode	op;
 		    Language_Execute_BadStreamAbortMessage((TLint4) TL_TLI_TLIXSN, "I/O");
 		} else {
 		    TLSETL(101315);
-		    if (TL_TLI_TLIXSN > 20) {
+		    if (TL_TLI_TLIXSN > TL_TLI_MAXSTREAM) {
 			TLSETL(101319);
 			{
 			    TLstring	__x2237;
@@ -2930,7 +2938,7 @@ Language_Opcode	op;
 		    };
 		};
 		TLSETL(101320);
-		if ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)]) == -3) {
+		if ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)]) == -3) {
 		    Language_StreamModeSet	openMode;
 		    TLSETL(101321);
 		    if (TL_TLI_TLIXSN > Language_Execute_numArguments) {
@@ -3104,7 +3112,7 @@ Language_Opcode	op;
 	default :
 	    {
 		TLSETL(101423);
-		if (op > 254) {
+		if (op > 255) {
 		    TLSETL(101426);
 		    {
 			TLstring	__x2268;
@@ -3119,7 +3127,7 @@ Language_Opcode	op;
 		    TLSETL(101434);
 		    {
 			TLstring	__x2269;
-			//TL_TLS_TLSCAT("Unimplemented opcode ", Language_OpcodeName[TLINRANGELOW(op, 0, 254, 1)], __x2269);
+			//TL_TLS_TLSCAT("Unimplemented opcode ", Language_OpcodeName[TLINRANGELOW(op, 0, 255, 1)], __x2269);
 			TL_TLS_TLSCAT("Unimplemented opcode ", "<opcode finding disabled, see execute.c>", __x2269);
 			Language_Execute_ExecutionError_Abort((TLint4) 10000, __x2269);
 		    };
@@ -3154,7 +3162,9 @@ void Language_Execute_RecoverAllMemory () {
     Language_Execute_EQHead = (struct Language_Execute_ProcessDescriptor *) 0;
     TLRESTORELF();
 }
-TLint4	Language_Execute_quantaCount;
+TLVMSTATE TLint4	Language_Execute_quantaCount;
+TLVMSTATE TLint4	Language_Execute_quantum;
+TLVMSTATE TLnat4	Language_Execute_switchCount;
 
 void Language_Execute_Initialize (startPC, maxStackSize, inName, outName, args, numArgs)
 TLaddressint	startPC;
@@ -3256,7 +3266,7 @@ TLint4	numArgs;
     TLSETL(101511);
     for(;;) {
 	TLSETL(101513);
-	Language_Execute_Heap_Alloc(&(stackBase), (TLnat4) ((256 + stackSize) + sizeof(struct Language_Execute_ProcessDescriptor)));
+	Language_Execute_Heap_AllocStack(&(stackBase), (TLnat4) ((256 + stackSize) + sizeof(struct Language_Execute_ProcessDescriptor)));
 	if ((unsigned long) stackBase != 0) {
 	    break;
 	};
@@ -3306,6 +3316,7 @@ TLint4	numArgs;
     Language_Execute_RQHead->dispatchPriority = 1000;
     TLINCL();
     Language_Execute_RQHead->totalPause = 0;
+    Language_Execute_RQHead->switches = 0;
     TLINCL();
     Language_Execute_RQHead->activeHandler = (struct Language_Execute_HandlerArea *) 0;
     TLINCL();
@@ -3325,6 +3336,7 @@ TLint4	numArgs;
     Language_Execute_Chrono = 0;
     TLINCL();
     Language_Execute_quantaCount = 20;
+    Language_Execute_switchCount = 0;
     TLINCL();
     Language_Execute_processCount = 0;
     TLSETL(101565);
@@ -3607,7 +3619,7 @@ struct Language_RunStatus	*runStatus;
 	    TLSETL(101684);
 	    if (Language_Execute_RQHead != oldRQHead) {
 		TLSETL(101685);
-		Language_Execute_quantaCount = 20;
+		Language_Execute_quantaCount = Language_Execute_quantum;
 		TLINCL();
 		if ((oldRQHead == ((struct Language_Execute_ProcessDescriptor *) 0)) || ((oldRQHead->stepSpec) != 0)) {
 		    TLSETL(101688);
@@ -3691,9 +3703,9 @@ void Language_Execute () {
     TLINCL();
     {
 	register TLint4	i;
-	for (i = 1; i <= 20; i++) {
+	for (i = 1; i <= TL_TLI_MAXSTREAM; i++) {
 	    TLSETL(100195);
-	    Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)] = -3;
+	    Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)] = -3;
 	    TLINCL();
 	    Language_Execute_argumentNames[TLINRANGELOW(i, 0, 20, 1)] = (Language_StringDef *) 0;
 	};
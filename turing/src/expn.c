@@ -340,7 +340,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2744[22];
-typedef	Language___x2744	Language___x2743[255];
+typedef	Language___x2744	Language___x2743[256];
 extern Language___x2743	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
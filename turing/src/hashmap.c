@@ -6,167 +6,193 @@
 #include <stdlib.h>
 #include <assert.h>
 
+/*
+ * Open addressing with linear probing.  Each slot keeps the hash of its
+ * key, so a probe only compares keys whose hashes match, and growing the
+ * table never looks at a key at all.  Removal shifts the rest of the
+ * probe run back instead of leaving a tombstone.  The keys themselves
+ * are copied back to back into one arena; the space of removed keys is
+ * reclaimed by compacting the arena once it is half dead.
+ *
+ * The map keeps one cursor for hashmapFirst and hashmapNext, which walk
+ * the slots in order, starting just after an empty one.  No probe run
+ * crosses an empty slot, so removal only ever moves an entry to an
+ * earlier point of the walk.
+ */
+
+/* ***************************************************************** constants */
+
+#define MIN_SLOTS 8
+#define MIN_ARENA 256
+
 /* *************************************************************** structures */
 
 typedef struct
 {
-    char* key;  
-    void* data; 
+    unsigned int hash;   /* 0 for an empty slot */
+    unsigned int key;    /* offset of the key in the arena */
+    unsigned int length; /* of the key, without its terminating 0 */
+    int data;
 } hashmapEntry;
 
 struct sHashmap
 {
-    hashmapEntry* array; 
-    size_t size,         
-           count;        
+    hashmapEntry* array;
+    size_t size,         /* number of slots - 1 */
+           count;
+    char* keys;
+    size_t used,         /* bytes of the arena in use, removed keys included */
+           dead,         /* bytes of removed keys */
+           capacity;
+    size_t start,        /* an empty slot; the walk goes round from there */
+           cursor;       /* place in the walk after the last entry returned */
 };
 
-static void rehash(hashmap* map);
+static size_t slotsFor(unsigned int count);
 
-static int insert(hashmap* map, void* data, char* key);
+static int rehash(hashmap* map, size_t slots);
 
-static hashmapEntry* find(const hashmap* map, const char* key);
+static int compact(hashmap* map);
 
-static int compare(const hashmapEntry* lhs, const hashmapEntry* rhs);
+static size_t find(const hashmap* map, const char* key, size_t length,
+                   unsigned int hash);
 
-static unsigned long hash1(const char* rawKey)
+static int compare(const void* lhs, const void* rhs);
+
+static const char* processKeys;
+
+static unsigned int hashKey(const char* key, size_t length)
 {
-    const unsigned char* s = (const unsigned char*) rawKey;
-    unsigned long hash = 0;
-    
-    do
+    /* MurmurHash3, 32 bit */
+    const unsigned char* s = (const unsigned char*) key;
+    unsigned int hash = 0x9747b28c, k;
+    size_t i;
+
+    for (i = 0; i + 4 <= length; i += 4)
+    {
+        memcpy(&k, s + i, 4);
+        k *= 0xcc9e2d51;
+        k = (k << 15) | (k >> 17);
+        k *= 0x1b873593;
+        hash ^= k;
+        hash = (hash << 13) | (hash >> 19);
+        hash = hash * 5 + 0xe6546b64;
+    }
+    k = 0;
+    switch (length & 3)
     {
-        hash = *s + (hash << 6) + (hash << 16) - hash;
+        case 3: k ^= s[i + 2] << 16;
+        case 2: k ^= s[i + 1] << 8;
+        case 1: k ^= s[i];
+                k *= 0xcc9e2d51;
+                k = (k << 15) | (k >> 17);
+                k *= 0x1b873593;
+                hash ^= k;
     }
-    while (*++s);
-    
-    return hash;
+    hash ^= (unsigned int) length;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+
+    /* 0 marks an empty slot */
+    return hash ? hash : 1;
 }
 
-static unsigned long hash2(const char* rawKey)
+static size_t slotsFor(unsigned int count)
 {
-    const unsigned char* s = (const unsigned char*) rawKey;
-    unsigned long hash = 0;
-    
-    do
-    {
-        hash ^= (unsigned long) *s;
-        hash += (hash << 1) + (hash << 4) + (hash << 7) + (hash << 8) + (hash << 24);
-    }
-    while (*++s);
-    
-    return hash;
+    size_t size = MIN_SLOTS;
+
+    if (count > HASHMAP_MAX_RESERVE)
+        count = HASHMAP_MAX_RESERVE;
+
+    /* keep the table at most three quarters full */
+    while (size / 4 * 3 < count)
+        size <<= 1;
+    return size;
 }
 
-static void rehash(hashmap* map)
+static int rehash(hashmap* map, size_t slots)
 {
-    size_t size;
+    size_t size, index, i;
     hashmapEntry* array = map->array;
-    
-    /* double the size of the array */
-    size = ++map->size;
-    map->size <<= 1;
-    map->array = (hashmapEntry*) calloc(sizeof(hashmapEntry), map->size);
-    --map->size;
-    map->count = 0;
-    
-    /* re-insert all elements */
-    do
+
+    if (slots > (size_t) -1 / sizeof(hashmapEntry))
+        return 0;
+    map->array = (hashmapEntry*) calloc(sizeof(hashmapEntry), slots);
+    if (!map->array)
     {
-        --size;
-        if (array[size].key)
-            insert(map, array[size].data, array[size].key);
+        map->array = array;
+        return 0;
     }
-    while (size);
-    
+    size = map->size + 1;
+    map->size = slots - 1;
+
+    /* re-insert all elements, by their stored hashes */
+    for (i = 0; i < size; ++i)
+    {
+        if (array[i].hash)
+        {
+            index = array[i].hash & map->size;
+            while (map->array[index].hash)
+                index = (index + 1) & map->size;
+            map->array[index] = array[i];
+        }
+    }
+
     /* return unused memory */
     free(array);
+    return 1;
 }
 
-static hashmapEntry* find(const hashmap* map, const char* key)
+static int compact(hashmap* map)
 {
-    unsigned long index, step, initialIndex;
-    hashmapEntry* freeEntry = 0;
-    
-    initialIndex = index = hash1(key) & map->size;
-    
-    /* first try */
-    if (map->array[index].key)
-    {
-        if (!strcmp(map->array[index].key, key))
-            return &map->array[index];
-    }
-    else if (!map->array[index].data)
-    {
-        return &map->array[index];
-    }
-    else
-    {
-        freeEntry = &map->array[index];
-    }
-    
-    /* collision */
-    step = (hash2(key) % map->size) + 1;
-    
-    do
+    char* keys = (char*) malloc(map->capacity);
+    size_t used = 0, i;
+
+    if (!keys)
+        return 0;
+
+    for (i = 0; i <= map->size; ++i)
     {
-        index = (index + step) & map->size;
-        
-        if (map->array[index].key)
+        if (map->array[i].hash)
         {
-            if (!strcmp(map->array[index].key, key))
-                return &map->array[index];
-        }
-        else if (!map->array[index].data)
-        {
-            return (freeEntry) ? freeEntry : &map->array[index];
-        }
-        else if (!freeEntry)
-        {
-            freeEntry = &map->array[index];
+            memcpy(keys + used, map->keys + map->array[i].key,
+                   map->array[i].length + 1);
+            map->array[i].key = (unsigned int) used;
+            used += map->array[i].length + 1;
         }
     }
-    while (index != initialIndex);
-    
-    return freeEntry;
+    free(map->keys);
+    map->keys = keys;
+    map->used = used;
+    map->dead = 0;
+    return 1;
 }
 
-static int insert(hashmap* map, void* data, char* key)
+static size_t find(const hashmap* map, const char* key, size_t length,
+                   unsigned int hash)
 {
-    hashmapEntry* entry;
-    if (map->size == map->count)
-        rehash(map);
-    do
+    size_t index = hash & map->size;
+
+    /* the table is never full, so this stops at an empty slot */
+    while (map->array[index].hash)
     {
-        entry = find(map, key);
-        if (entry)
-        {
-            entry->data = data;
-            
-            if (entry->key)
-            {
-                /* updated the entry */
-                free(key);
-                return HASHMAP_UPDATE;
-            }
-            else
-            {
-                /* inserted the entry */
-                ++map->count;
-                entry->key = key;
-                return HASHMAP_INSERT;
-            }
-        }
-        
-        rehash(map);
+        if (map->array[index].hash == hash &&
+            map->array[index].length == length &&
+            !memcmp(map->keys + map->array[index].key, key, length))
+            break;
+        index = (index + 1) & map->size;
     }
-    while (1);
+
+    return index;
 }
 
-static int compare(const hashmapEntry* lhs, const hashmapEntry* rhs)
+static int compare(const void* lhs, const void* rhs)
 {
-    return (lhs->key)  ? (rhs->key) ? strcmp(lhs->key, rhs->key) : -1
-                       : (rhs->key) ? 1 : 0;
+    return strcmp(processKeys + ((const hashmapEntry*) lhs)->key,
+                  processKeys + ((const hashmapEntry*) rhs)->key);
 }
 
 /* ******************************************************* exported functions */
@@ -174,105 +200,240 @@ static int compare(const hashmapEntry* lhs, const hashmapEntry* rhs)
 hashmap* newHashmap(unsigned int hint)
 {
     hashmap* map = (hashmap*) malloc(sizeof(hashmap));
-        
-    if (hint < 4)
+    size_t size = slotsFor(hint);
+
+    if (!map)
+        return 0;
+    map->array = (hashmapEntry*) calloc(sizeof(hashmapEntry), size);
+    map->size = size - 1;
+    map->count = 0;
+    map->capacity = (size > MIN_ARENA) ? size * 8 : MIN_ARENA;
+    map->keys = (char*) malloc(map->capacity);
+    if (!map->array || !map->keys)
     {
-        hint = 4;
+        free(map->array);
+        free(map->keys);
+        free(map);
+        return 0;
     }
-    else if (hint & (hint - 1))
-    {
-        unsigned int i = 1;
-        
-        do
-        {
-            hint |= (hint >> i);
-            i <<= 1;
-        }
-        while (i <= (sizeof(hint) << 2));
-        ++hint;
-    }
-    map->array = (hashmapEntry*) calloc(sizeof(hashmapEntry), hint);
-    map->size = hint - 1;
-    map->count = 0;
+    map->used = 0;
+    map->dead = 0;
+    map->start = 0;
+    map->cursor = map->size + 1;
     return map;
 }
 
 void deleteHashmap(hashmap* map)
 {
-    unsigned long index = 0;
-    
     assert(map);
-    
-    do
-    {
-        if (map->array[index].key)
-            free(map->array[index].key);
-    }
-    while (++index <= map->size);
+
     free(map->array);
+    free(map->keys);
     free(map);
 }
 
-int hashmapSet(hashmap* map, void* data, const char* key)
+int hashmapSet(hashmap* map, int data, const char* key)
 {
-    return (map && key && *key)  ? insert(map, data, strdup(key))
-                                 : HASHMAP_ILLEGAL;
+    size_t length, index;
+    unsigned int hash;
+
+    if (!map || !key || !*key)
+        return HASHMAP_ILLEGAL;
+
+    length = strlen(key);
+    hash = hashKey(key, length);
+    index = find(map, key, length, hash);
+
+    if (map->array[index].hash)
+    {
+        /* updated the entry */
+        map->array[index].data = data;
+        return HASHMAP_UPDATE;
+    }
+
+    if ((map->count + 1) * 4 > (map->size + 1) * 3)
+    {
+        /* double the size of the array */
+        if (!rehash(map, (map->size + 1) << 1))
+            return HASHMAP_NO_MEMORY;
+        index = find(map, key, length, hash);
+    }
+
+    if (map->used + length + 1 > map->capacity)
+    {
+        if (map->dead >= map->used / 2 &&
+            map->used - map->dead + length + 1 <= map->capacity)
+        {
+            if (!compact(map))
+                return HASHMAP_NO_MEMORY;
+        }
+        else
+        {
+            size_t capacity = map->capacity;
+            char* keys;
+
+            while (map->used + length + 1 > capacity)
+                capacity <<= 1;
+            keys = (char*) realloc(map->keys, capacity);
+            if (!keys)
+                return HASHMAP_NO_MEMORY;
+            map->keys = keys;
+            map->capacity = capacity;
+        }
+    }
+
+    /* inserted the entry */
+    memcpy(map->keys + map->used, key, length + 1);
+    map->array[index].hash = hash;
+    map->array[index].key = (unsigned int) map->used;
+    map->array[index].length = (unsigned int) length;
+    map->array[index].data = data;
+    map->used += length + 1;
+    ++map->count;
+    return HASHMAP_INSERT;
 }
 
-void* hashmapGet(const hashmap* map, const char* key)
+int hashmapGet(const hashmap* map, const char* key, int* data)
 {
-    hashmapEntry* entry;
+    size_t length, index;
+
     assert(map && key && *key);
-    
-    entry = find(map, key);
-    
-    if (entry && entry->key)
-        return entry->data;
-    
+
+    length = strlen(key);
+    index = find(map, key, length, hashKey(key, length));
+
+    if (map->array[index].hash)
+    {
+        *data = map->array[index].data;
+        return 1;
+    }
+
     return 0;
 }
 
-void* hashmapRemove(hashmap* map, const char* key)
+int hashmapRemove(hashmap* map, const char* key)
 {
-    void* res = 0;
-    hashmapEntry* entry;
-    
+    size_t length, index, next, home;
+
     assert(map && key && *key);
-    
-    entry = find(map, key);
-    
-    if (entry && entry->key)
+
+    length = strlen(key);
+    index = find(map, key, length, hashKey(key, length));
+
+    if (!map->array[index].hash)
+        return 0;
+
+    --map->count;
+    map->dead += length + 1;
+
+    /* move back each later entry of the run that may live in the hole */
+    next = index;
+    while (1)
+    {
+        next = (next + 1) & map->size;
+        if (!map->array[next].hash)
+            break;
+        home = map->array[next].hash & map->size;
+        if (((next - home) & map->size) >= ((next - index) & map->size))
+        {
+            /* hashmapNext has not seen it yet, so must look at it here */
+            if (((index - map->start) & map->size) + 1 == map->cursor)
+                --map->cursor;
+            map->array[index] = map->array[next];
+            index = next;
+        }
+    }
+    map->array[index].hash = 0;
+
+    return 1;
+}
+
+int hashmapReserve(hashmap* map, unsigned int count)
+{
+    size_t slots = slotsFor(count);
+
+    assert(map);
+
+    if (slots > map->size + 1)
+        return rehash(map, slots);
+    return 1;
+}
+
+unsigned int hashmapCount(const hashmap* map)
+{
+    assert(map);
+
+    return (unsigned int) map->count;
+}
+
+void hashmapClear(hashmap* map)
+{
+    assert(map);
+
+    /* keep the table and the arena for the next keys */
+    memset(map->array, 0, sizeof(hashmapEntry) * (map->size + 1));
+    map->count = 0;
+    map->used = 0;
+    map->dead = 0;
+    map->cursor = map->size + 1;
+}
+
+int hashmapFirst(hashmap* map, const char** key, int* data)
+{
+    assert(map);
+
+    /* the table is never full */
+    map->start = 0;
+    while (map->array[map->start].hash)
+        ++map->start;
+    map->cursor = 1;
+    return hashmapNext(map, key, data);
+}
+
+int hashmapNext(hashmap* map, const char** key, int* data)
+{
+    size_t i, slot;
+
+    assert(map);
+
+    for (i = map->cursor; i <= map->size; ++i)
     {
-        --map->count;
-        
-        free(entry->key);
-        entry->key = 0;
-        res = entry->data;
-        
-        /* setting exist to one indicates that this entry was already in use */
-        entry->data = (void*) 1;
+        slot = (map->start + i) & map->size;
+        if (map->array[slot].hash)
+        {
+            *key = map->keys + map->array[slot].key;
+            *data = map->array[slot].data;
+            map->cursor = i + 1;
+            return 1;
+        }
     }
-    
-    return res;
+    map->cursor = map->size + 1;
+
+    return 0;
 }
 
-void hashmapProcess(const hashmap* map, fHashmapProc proc)
+int hashmapProcess(const hashmap* map, fHashmapProc proc)
 {
     hashmapEntry* array;
-    size_t size;
-    unsigned int i;
-    
+    size_t i, count = 0;
+
     assert(map);
-    
-    size = map->size + 1;
-    array = (hashmapEntry*) malloc(sizeof(hashmapEntry) * size);
-    
-    memcpy(array, map->array, sizeof(hashmapEntry) * size);
-    qsort(array, size, sizeof(hashmapEntry),
-                (int(*)(const void*, const void*)) compare);
-    
-    for (i = 0; i < map->count; ++i)
-        proc(array[i].key, array[i].data);
-    
+
+    array = (hashmapEntry*) malloc(sizeof(hashmapEntry) * (map->count + 1));
+    if (!array)
+        return 0;
+
+    for (i = 0; i <= map->size; ++i)
+        if (map->array[i].hash)
+            array[count++] = map->array[i];
+
+    /* in key order */
+    processKeys = map->keys;
+    qsort(array, count, sizeof(hashmapEntry), compare);
+
+    for (i = 0; i < count; ++i)
+        proc(map->keys + array[i].key, array[i].data);
+
     free(array);
+    return 1;
 }
@@ -5,21 +5,53 @@
 /* forward declaration of opaque structure */
 typedef struct sHashmap hashmap;
 
-#define HASHMAP_ILLEGAL 0   
-#define HASHMAP_INSERT 1    
-#define HASHMAP_UPDATE 2    
-typedef void(*fHashmapProc)(const char* key, const void* datum);
+#define HASHMAP_ILLEGAL 0
+#define HASHMAP_INSERT 1
+#define HASHMAP_UPDATE 2
+#define HASHMAP_NO_MEMORY 3
 
+/* the most keys hashmapReserve will make room for */
+#define HASHMAP_MAX_RESERVE (1 << 24)
+typedef void(*fHashmapProc)(const char* key, int datum);
+
+/* hint is the number of keys expected; returns 0 if out of memory */
 extern hashmap* newHashmap(unsigned int hint);
 
 extern void deleteHashmap(hashmap* map);
 
-extern int hashmapSet(hashmap* map, void* data, const char* key);
+extern int hashmapSet(hashmap* map, int data, const char* key);
+
+/* returns 1 and sets *data if key is in the map, otherwise returns 0 */
+extern int hashmapGet(const hashmap* map, const char* key, int* data);
+
+/* returns 1 if key was in the map */
+extern int hashmapRemove(hashmap* map, const char* key);
+
+/*
+ * make room for count keys, at most HASHMAP_MAX_RESERVE, so that adding
+ * them never grows the table; returns 0 if out of memory
+ */
+extern int hashmapReserve(hashmap* map, unsigned int count);
+
+extern unsigned int hashmapCount(const hashmap* map);
+
+/* removes every key, keeping the storage */
+extern void hashmapClear(hashmap* map);
 
-extern void* hashmapGet(const hashmap* map, const char* key);
+/*
+ * hashmapFirst and hashmapNext return 1 and set *key and *data for each key
+ * in turn, in no particular order, then return 0.  Removing the key just
+ * returned is allowed; adding keys or reserving in the middle of a walk
+ * is not.
+ */
+extern int hashmapFirst(hashmap* map, const char** key, int* data);
 
-extern void* hashmapRemove(hashmap* map, const char* key);
+extern int hashmapNext(hashmap* map, const char** key, int* data);
 
-extern void hashmapProcess(const hashmap* map, fHashmapProc proc);
+/*
+ * hashmapProcess calls proc for each key in key order; returns 0, without
+ * calling it, if out of memory
+ */
+extern int hashmapProcess(const hashmap* map, fHashmapProc proc);
 
 #endif
@@ -332,7 +332,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x1307[22];
-typedef	Language___x1307	Language___x1306[255];
+typedef	Language___x1307	Language___x1306[256];
 extern Language___x1306	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -453,9 +453,9 @@ extern void Language_Execute_SetStep ();
 extern void Language_Execute_DumpThreadList ();
 
 extern void Language_Execute_UnitInitState ();
-extern TLint2	Language_Execute_executionTimeout;
-extern TLint4	Language_Execute_stackAllocated;
-extern TLboolean	Language_Execute_allWaitingForKeyboard;
+extern TLVMSTATE TLint2	Language_Execute_executionTimeout;
+extern TLVMSTATE TLint4	Language_Execute_stackAllocated;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -553,16 +553,20 @@ void Language_Execute_ExecutionError_Initialize ();
 
 void Language_Execute_Heap_Alloc ();
 
+void Language_Execute_Heap_AllocStack ();
+
 void Language_Execute_Heap_CleanUp ();
 
 void Language_Execute_Heap_Dealloc ();
 
+void Language_Execute_Heap_DeallocStack ();
+
 void Language_Execute_Heap_Free ();
 
 void Language_Execute_Heap_New ();
 
 void Language_Execute_Heap_Realloc ();
-static TLnat4	Language_Execute_Heap_TimeStamper;
+static TLVMSTATE TLnat4	Language_Execute_Heap_TimeStamper;
 struct	Language_Execute_Heap_HeapReference {
     TLaddressint	next, prev;
     struct SrcPosition	srcPos;
@@ -578,7 +582,7 @@ struct	Language_Execute_Heap_MallocTemplate2 {
     struct Language_Execute_Heap_HeapReference	heapRef;
     Language_Execute_Heap_AlignType	data;
 };
-static struct Language_Execute_Heap_HeapReference	Language_Execute_Heap_rootHeapRef;
+static TLVMSTATE struct Language_Execute_Heap_HeapReference	Language_Execute_Heap_rootHeapRef;
 
 
 
@@ -766,6 +770,79 @@ TLaddressint	*ptr;
     TLRESTORELF();
 }
 
+/*
+ * A process's stack and descriptor are one block.  When the process
+ * ends, DeallocStack keeps the block for the next fork of the same size,
+ * up to StackPoolMax bytes in all, rather than freeing it.  Kept blocks
+ * stay on the heap list, so CleanUp frees them with everything else.
+ * The first word of the block lies below the 256 bytes of slack under
+ * minimumSP and holds StackGuard, which is checked whenever a block
+ * comes back; a stack that ran past the slack is caught there instead of
+ * being handed to the next process.
+ */
+#define Language_Execute_Heap_StackClasses	8
+#define Language_Execute_Heap_StackPoolMax	(4 * 1024 * 1024)
+#define Language_Execute_Heap_StackGuard	0x5354414b
+struct	Language_Execute_Heap_StackClass {
+    TLnat4	size;
+    TLaddressint	free;
+};
+static TLVMSTATE struct Language_Execute_Heap_StackClass	Language_Execute_Heap_stackPool[Language_Execute_Heap_StackClasses];
+static TLVMSTATE TLnat4	Language_Execute_Heap_stackPoolBytes;
+
+void Language_Execute_Heap_AllocStack (ptr, objSize)
+TLaddressint	*ptr;
+TLnat4	objSize;
+{
+    register struct Language_Execute_Heap_StackClass	*sc;
+    register TLint4	i;
+    for (i = 0; i < Language_Execute_Heap_StackClasses; i++) {
+	sc = &(Language_Execute_Heap_stackPool[i]);
+	if (((sc->size) == objSize) && ((unsigned long) (sc->free) != 0)) {
+	    (*ptr) = (TLaddressint) (sc->free);
+	    sc->free = (TLaddressint) ((* (TLaddressint *) ((unsigned long) (*ptr) + sizeof(TLnat4))));
+	    Language_Execute_Heap_stackPoolBytes -= objSize;
+	    return;
+	};
+    };
+    Language_Execute_Heap_Alloc(ptr, objSize);
+    if ((unsigned long) (*ptr) != 0) {
+	(* (TLnat4 *) (*ptr)) = Language_Execute_Heap_StackGuard;
+    };
+}
+
+void Language_Execute_Heap_DeallocStack (ptr, objSize)
+TLaddressint	*ptr;
+TLnat4	objSize;
+{
+    register struct Language_Execute_Heap_StackClass	*sc;
+    register TLint4	i;
+    if ((* (TLnat4 *) (*ptr)) != Language_Execute_Heap_StackGuard) {
+	Language_Execute_ExecutionError_Abort((TLint4) 10000, "Stack overflow! A process ran past the end of its stack");
+    };
+    if ((Language_Execute_Heap_stackPoolBytes + objSize) <= Language_Execute_Heap_StackPoolMax) {
+	sc = (struct Language_Execute_Heap_StackClass *) 0;
+	for (i = 0; i < Language_Execute_Heap_StackClasses; i++) {
+	    if ((Language_Execute_Heap_stackPool[i].size) == objSize) {
+		sc = &(Language_Execute_Heap_stackPool[i]);
+		break;
+	    };
+	    if ((sc == ((struct Language_Execute_Heap_StackClass *) 0)) && ((unsigned long) (Language_Execute_Heap_stackPool[i].free) == 0)) {
+		sc = &(Language_Execute_Heap_stackPool[i]);
+	    };
+	};
+	if (sc != ((struct Language_Execute_Heap_StackClass *) 0)) {
+	    sc->size = objSize;
+	    (* (TLaddressint *) ((unsigned long) (*ptr) + sizeof(TLnat4))) = (TLaddressint) (sc->free);
+	    sc->free = (TLaddressint) (*ptr);
+	    Language_Execute_Heap_stackPoolBytes += objSize;
+	    (*ptr) = (TLaddressint) 0;
+	    return;
+	};
+    };
+    Language_Execute_Heap_Dealloc(ptr);
+}
+
 void Language_Execute_Heap_Realloc (ptr, newObjSize)
 TLaddressint	*ptr;
 TLnat4	newObjSize;
@@ -840,6 +917,14 @@ void Language_Execute_Heap_CleanUp () {
     Language_Execute_Heap_rootHeapRef.next = (TLaddressint) ((unsigned long)&(Language_Execute_Heap_rootHeapRef));
     TLINCL();
     Language_Execute_Heap_rootHeapRef.prev = (TLaddressint) ((unsigned long)&(Language_Execute_Heap_rootHeapRef));
+    {
+	register TLint4	i;
+	for (i = 0; i < Language_Execute_Heap_StackClasses; i++) {
+	    Language_Execute_Heap_stackPool[i].size = 0;
+	    Language_Execute_Heap_stackPool[i].free = (TLaddressint) 0;
+	};
+	Language_Execute_Heap_stackPoolBytes = 0;
+    };
     TLRESTORELF();
 }
 
@@ -0,0 +1,238 @@
+/***************************************************************************/
+#include "intmap.h"
+
+#include <stdlib.h>
+#include <assert.h>
+
+/*
+ * The int keyed counterpart of hashmap.c.  Keys and values sit side by
+ * side in one flat array, probed linearly from a multiplicative hash of
+ * the key, with INTMAP_NO_KEY marking an empty slot.  Removal shifts the
+ * rest of the probe run back instead of leaving a tombstone.
+ */
+
+/* ***************************************************************** constants */
+
+#define MIN_BITS 3
+
+/* *************************************************************** structures */
+
+typedef struct
+{
+    int key;
+    int data;
+} intmapEntry;
+
+struct sIntmap
+{
+    intmapEntry* array;
+    unsigned int bits,   /* the table has 1 << bits slots */
+                 size,   /* number of slots - 1 */
+                 count;
+};
+
+static int resize(intmap* map, unsigned int bits);
+
+static unsigned int find(const intmap* map, int key);
+
+#define HOME(map, key) \
+    ((unsigned int) ((unsigned int) (key) * 0x9e3779b9u) >> (32 - (map)->bits))
+
+static void clearArray(intmapEntry* array, unsigned int slots)
+{
+    unsigned int i;
+
+    for (i = 0; i < slots; ++i)
+        array[i].key = INTMAP_NO_KEY;
+}
+
+static int resize(intmap* map, unsigned int bits)
+{
+    unsigned int size = map->size + 1, index, i;
+    intmapEntry* array = map->array;
+
+    /* HOME needs bits < 32, and the size in bytes must fit in a size_t */
+    if (bits > 31 || bits >= sizeof(size_t) * 8 - 3)
+        return 0;
+    map->array = (intmapEntry*) malloc(sizeof(intmapEntry) * ((size_t) 1 << bits));
+    if (!map->array)
+    {
+        map->array = array;
+        return 0;
+    }
+    map->bits = bits;
+    map->size = (1u << bits) - 1;
+    clearArray(map->array, map->size + 1);
+
+    /* re-insert all elements; no key is there twice, so none is compared */
+    for (i = 0; i < size; ++i)
+    {
+        if (array[i].key != INTMAP_NO_KEY)
+        {
+            index = HOME(map, array[i].key);
+            while (map->array[index].key != INTMAP_NO_KEY)
+                index = (index + 1) & map->size;
+            map->array[index] = array[i];
+        }
+    }
+
+    /* return unused memory */
+    free(array);
+    return 1;
+}
+
+static unsigned int find(const intmap* map, int key)
+{
+    unsigned int index = HOME(map, key);
+
+    /* the table is never full, so this stops at an empty slot */
+    while (map->array[index].key != key &&
+           map->array[index].key != INTMAP_NO_KEY)
+        index = (index + 1) & map->size;
+
+    return index;
+}
+
+/* ******************************************************* exported functions */
+
+intmap* newIntmap(unsigned int hint)
+{
+    intmap* map = (intmap*) malloc(sizeof(intmap));
+
+    if (!map)
+        return 0;
+    map->bits = MIN_BITS;
+    map->size = (1u << MIN_BITS) - 1;
+    map->count = 0;
+    map->array = (intmapEntry*) malloc(sizeof(intmapEntry) * (map->size + 1));
+    if (map->array)
+        clearArray(map->array, map->size + 1);
+    if (!map->array || !intmapReserve(map, hint))
+    {
+        free(map->array);
+        free(map);
+        return 0;
+    }
+    return map;
+}
+
+void deleteIntmap(intmap* map)
+{
+    assert(map);
+
+    free(map->array);
+    free(map);
+}
+
+int intmapSet(intmap* map, int key, int data)
+{
+    unsigned int index;
+
+    assert(map && key != INTMAP_NO_KEY);
+
+    index = find(map, key);
+
+    if (map->array[index].key == key)
+    {
+        map->array[index].data = data;
+        return INTMAP_UPDATE;
+    }
+
+    /* keep the table at most three quarters full */
+    if ((map->count + 1) * 4 > (map->size + 1) * 3)
+    {
+        if (!resize(map, map->bits + 1))
+            return INTMAP_NO_MEMORY;
+        index = find(map, key);
+    }
+
+    map->array[index].key = key;
+    map->array[index].data = data;
+    ++map->count;
+    return INTMAP_INSERT;
+}
+
+int intmapGet(const intmap* map, int key, int* data)
+{
+    unsigned int index;
+
+    assert(map);
+
+    if (key == INTMAP_NO_KEY)
+        return 0;
+
+    index = find(map, key);
+
+    if (map->array[index].key == key)
+    {
+        *data = map->array[index].data;
+        return 1;
+    }
+
+    return 0;
+}
+
+int intmapRemove(intmap* map, int key)
+{
+    unsigned int index, next, home;
+
+    assert(map);
+
+    if (key == INTMAP_NO_KEY)
+        return 0;
+
+    index = find(map, key);
+
+    if (map->array[index].key != key)
+        return 0;
+
+    --map->count;
+
+    /* move back each later entry of the run that may live in the hole */
+    next = index;
+    while (1)
+    {
+        next = (next + 1) & map->size;
+        if (map->array[next].key == INTMAP_NO_KEY)
+            break;
+        home = HOME(map, map->array[next].key);
+        if (((next - home) & map->size) >= ((next - index) & map->size))
+        {
+            map->array[index] = map->array[next];
+            index = next;
+        }
+    }
+    map->array[index].key = INTMAP_NO_KEY;
+
+    return 1;
+}
+
+unsigned int intmapCount(const intmap* map)
+{
+    assert(map);
+
+    return map->count;
+}
+
+void intmapClear(intmap* map)
+{
+    assert(map);
+
+    clearArray(map->array, map->size + 1);
+    map->count = 0;
+}
+
+int intmapReserve(intmap* map, unsigned int count)
+{
+    unsigned int bits = map->bits;
+
+    assert(map);
+
+    if (count > INTMAP_MAX_RESERVE)
+        count = INTMAP_MAX_RESERVE;
+    while (((1u << bits) / 4) * 3 < count)
+        ++bits;
+    if (bits != map->bits)
+        return resize(map, bits);
+    return 1;
+}
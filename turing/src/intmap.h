@@ -0,0 +1,43 @@
+/***************************************************************************/
+#ifndef INTMAP_H_INCLUDED
+#define INTMAP_H_INCLUDED
+
+/* forward declaration of opaque structure */
+typedef struct sIntmap intmap;
+
+/* never a key; Turing uses it for an uninitialized int */
+#define INTMAP_NO_KEY ((int) 0x80000000)
+
+#define INTMAP_NO_MEMORY 0
+#define INTMAP_INSERT 1
+#define INTMAP_UPDATE 2
+
+/* the most keys intmapReserve will make room for */
+#define INTMAP_MAX_RESERVE (1 << 24)
+
+/* hint is the number of keys expected; returns 0 if out of memory */
+extern intmap* newIntmap(unsigned int hint);
+
+extern void deleteIntmap(intmap* map);
+
+/* returns INTMAP_NO_MEMORY, leaving the map as it was, if it can't grow */
+extern int intmapSet(intmap* map, int key, int data);
+
+/* returns 1 and sets *data if key is in the map, otherwise returns 0 */
+extern int intmapGet(const intmap* map, int key, int* data);
+
+/* returns 1 if key was in the map */
+extern int intmapRemove(intmap* map, int key);
+
+extern unsigned int intmapCount(const intmap* map);
+
+/* removes every key but keeps the table */
+extern void intmapClear(intmap* map);
+
+/*
+ * grows the table to hold count keys, at most INTMAP_MAX_RESERVE, without
+ * growing again; returns 0 if out of memory, leaving the map as it was
+ */
+extern int intmapReserve(intmap* map, unsigned int count);
+
+#endif
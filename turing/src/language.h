@@ -5,6 +5,7 @@
 
 
 typedef signed char	TLint1;
+typedef short		TLint2;
 typedef char TLstring[256];
 
 
@@ -106,6 +107,20 @@ extern void Language_CompileUnit (TLstring fileName, FileNoType fileNo,
 extern void Language_CompileProgram (TLstring fileName, FileNoType fileNo,
 	Language_ErrMsgs **firstErrPtr, long *errorCount);
 
+// Highest stream number, as TL_TLI_MAXSTREAM in cinterface
+#define MaxStream   1024
+
+// Thread local in a reentrant build, as in cinterface
+#ifdef TL_REENTRANT
+#ifdef _MSC_VER
+#define TLVMSTATE	__declspec(thread)
+#else
+#define TLVMSTATE	__thread
+#endif
+#else
+#define TLVMSTATE
+#endif
+
 #define MaxArgs     20
 typedef TLstring OOTargs[MaxArgs+1];
 
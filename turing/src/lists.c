@@ -339,7 +339,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2709[22];
-typedef	Language___x2709	Language___x2708[255];
+typedef	Language___x2709	Language___x2708[256];
 extern Language___x2708	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
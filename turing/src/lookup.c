@@ -28,8 +28,11 @@ extern void Language_Execute_System_Getenv();
 extern void Language_Execute_System_Getpid();
 extern void Language_Execute_System_Nargs();
 extern void Language_Execute_System_Setactive();
+extern void Language_Execute_System_Setslice();
 extern void Language_Execute_System_Simutime();
+extern void Language_Execute_System_Switches();
 extern void Language_Execute_System_System();
+extern void Language_Execute_System_Totalswitches();
 
 extern void Limits_Getexp();
 extern void Limits_Rreb();
@@ -169,6 +172,43 @@ extern void MIO_hashmap_free ();
 extern void MIO_hashmap_put ();
 extern void MIO_hashmap_get ();
 extern void MIO_hashmap_remove ();
+extern void MIO_hashmap_reserve ();
+extern void MIO_hashmap_size ();
+extern void MIO_hashmap_clear ();
+extern void MIO_hashmap_first ();
+extern void MIO_hashmap_next ();
+
+extern void MIO_longstr_new ();
+extern void MIO_longstr_free ();
+extern void MIO_longstr_length ();
+extern void MIO_longstr_clear ();
+extern void MIO_longstr_assign ();
+extern void MIO_longstr_append ();
+extern void MIO_longstr_appendlong ();
+extern void MIO_longstr_sub ();
+extern void MIO_longstr_sublong ();
+extern void MIO_longstr_index ();
+extern void MIO_longstr_compare ();
+extern void MIO_longstr_getline ();
+extern void MIO_longstr_put ();
+
+extern void MIO_intmap_new ();
+extern void MIO_intmap_free ();
+extern void MIO_intmap_put ();
+extern void MIO_intmap_get ();
+extern void MIO_intmap_remove ();
+extern void MIO_intmap_contains ();
+extern void MIO_intmap_size ();
+extern void MIO_intmap_clear ();
+extern void MIO_intmap_reserve ();
+extern void MIO_intset_new ();
+extern void MIO_intset_add ();
+
+extern void MIO_stream_readall ();
+extern void MIO_stream_readlines ();
+extern void MIO_stream_getints ();
+extern void MIO_stream_getreals ();
+extern void MIO_stream_write ();
 
 extern void MIO_input_keydown ();
 
@@ -354,7 +394,10 @@ extern void Star_initialize();
 
 struct LookupEntry externLookupTable[] = {
 
+    { "concur_setslice",	Language_Execute_System_Setslice },
     { "concur_simutime",	Language_Execute_System_Simutime },
+    { "concur_switches",	Language_Execute_System_Switches },
+    { "concur_totalswitches",	Language_Execute_System_Totalswitches },
 
     { "config_display",		MIO_config_display },
     { "config_lang",		MIO_config_lang },
@@ -462,11 +505,16 @@ struct LookupEntry externLookupTable[] = {
     { "gui_savedlg",		MIO_gui_savedlg },
 */
 
+	{ "hashmap_clear", MIO_hashmap_clear },
+	{ "hashmap_first", MIO_hashmap_first },
 	{ "hashmap_free", MIO_hashmap_free },
 	{ "hashmap_get", MIO_hashmap_get },
 	{ "hashmap_new", MIO_hashmap_new },
+	{ "hashmap_next", MIO_hashmap_next },
 	{ "hashmap_put", MIO_hashmap_put },
 	{ "hashmap_remove", MIO_hashmap_remove },
+	{ "hashmap_reserve", MIO_hashmap_reserve },
+	{ "hashmap_size", MIO_hashmap_size },
 
     { "input_getch",		Language_Execute_Graphics_Getch },
     { "input_hasch",		Language_Execute_Graphics_Hasch },
@@ -474,6 +522,18 @@ struct LookupEntry externLookupTable[] = {
 
     { "interpret",		MT_InterpretIfc },
 
+    { "intmap_clear",		MIO_intmap_clear },
+    { "intmap_contains",	MIO_intmap_contains },
+    { "intmap_free",		MIO_intmap_free },
+    { "intmap_get",		MIO_intmap_get },
+    { "intmap_new",		MIO_intmap_new },
+    { "intmap_put",		MIO_intmap_put },
+    { "intmap_remove",		MIO_intmap_remove },
+    { "intmap_reserve",		MIO_intmap_reserve },
+    { "intmap_size",		MIO_intmap_size },
+    { "intset_add",		MIO_intset_add },
+    { "intset_new",		MIO_intset_new },
+
     { "joy_caps",		MIO_joy_caps },
     { "joy_read",		MIO_joy_read },
 
@@ -485,6 +545,20 @@ struct LookupEntry externLookupTable[] = {
     { "limits_rreb",		Limits_Rreb },
     { "limits_setexp",		Limits_Setexp },
 
+    { "longstr_append",		MIO_longstr_append },
+    { "longstr_appendlong",	MIO_longstr_appendlong },
+    { "longstr_assign",		MIO_longstr_assign },
+    { "longstr_clear",		MIO_longstr_clear },
+    { "longstr_compare",		MIO_longstr_compare },
+    { "longstr_free",		MIO_longstr_free },
+    { "longstr_getline",		MIO_longstr_getline },
+    { "longstr_index",		MIO_longstr_index },
+    { "longstr_length",		MIO_longstr_length },
+    { "longstr_new",		MIO_longstr_new },
+    { "longstr_put",		MIO_longstr_put },
+    { "longstr_sub",		MIO_longstr_sub },
+    { "longstr_sublong",		MIO_longstr_sublong },
+
     { "math_arctan",		Math_Arctan },
     { "math_arctand",		Math_Arctand },
     { "math_cos",		Math_Cos },
@@ -583,6 +657,11 @@ struct LookupEntry externLookupTable[] = {
     { "sprite_show",		MIO_sprite_show },
 
     { "stream_flushall",	Language_Execute_System_Flushstreams },
+    { "stream_getints",		MIO_stream_getints },
+    { "stream_getreals",	MIO_stream_getreals },
+    { "stream_readall",		MIO_stream_readall },
+    { "stream_readlines",	MIO_stream_readlines },
+    { "stream_write",		MIO_stream_write },
 
     { "string_chararraycopy",   String_CharArrayCopy },
     { "string_index",		String_Index },
@@ -330,7 +330,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x1982[22];
-typedef	Language___x1982	Language___x1981[255];
+typedef	Language___x1982	Language___x1981[256];
 extern Language___x1981	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
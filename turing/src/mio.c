@@ -105,6 +105,8 @@
 #include "miotime.h"
 #include "miowindow.h"
 #include "miohashmap.h"
+#include "miolongstr.h"
+#include "miointmap.h"
 
 #include "mioglgraph.h"
 
@@ -179,8 +181,11 @@ xxx
 #define TOP_RIGHT_ATTRIB		",position:right,top"
 #define MIDDLE_ATTRIB			",position:center,middle"
 
-// Information for stream manager calls
+// Information for ID manager calls.  The first MAX_IDS slots are numbered
+// x_ID_BASE + slot, as they always have been.  Later slots are numbered
+// from EXTRA_ID_BASE, interleaving the ID types.
 #define MAX_IDS		 	 	1000
+#define NUM_ID_KINDS			   8
 
 #define FONT_ID_BASE		   	5001
 #define DIR_ID_BASE			6001
@@ -188,6 +193,11 @@ xxx
 #define SPRITE_ID_BASE			8001
 #define LEX_ID_BASE			9001
 #define HASHMAP_ID_BASE			10001
+#define LONGSTR_ID_BASE			11001
+#define INTMAP_ID_BASE			12001
+#define EXTRA_ID_BASE			100001
+
+#define NO_SLOT				  -1
 
 /********************/
 /* Global variables */
@@ -234,6 +244,7 @@ typedef struct ID
     int		id;		// The id number slot # + x_ID_BASE
     int		type;		// What this ID is used for
     int		count;		// # times this ID used.
+    int		nextFree;	// Next slot on the free list
     void	*info;		// Information about the item
     void	*compareInfo;	// Information about the item used to determine
 				// if a new item should be allocated or 
@@ -251,6 +262,9 @@ extern int  (*TL_TLI_TLIFGC) (), (*TL_TLI_TLIFRE) (), (*TL_TLI_TLIFWR) ();
 extern long (*TL_TLI_TLIFTL) ();
 extern void TL_TLI_TLISF ();
 extern int TL_TLI_TLIEFR ();
+extern int TL_TLI_TLIBFG (), TL_TLI_TLIBFR (), TL_TLI_TLIBOW ();
+extern void TL_TLI_TLIBFU (), TL_TLI_TLIBOC (), TL_TLI_TLIBOS ();
+extern void TL_TLI_TLIBOF ();
 extern void Language_Execute_System_Setactive ();
 
 /********************/
@@ -262,6 +276,12 @@ static char	stTextStdoutWindow [100];
 static char	stGraphicsStdoutWindow [100];
 static char	*stStdErrorWindowAttribs = "text:3,20,popup,position:right,bottom,title:Standard Error";
 static char	*stSysExitString;
+// The ID type for each x_ID_BASE, in order, and the reverse
+static const int stIDKindTypes [NUM_ID_KINDS] =
+   {FONT_ID, DIR_ID, PIC_ID, SPRITE_ID, LEXER_ID, HASHMAP_ID, LONGSTR_ID,
+    INTMAP_ID};
+static const int stIDTypeKinds [INTMAP_ID - FONT_ID + 1] =
+   {0, 1, 2, 3, 4, -1, -1, 5, 6, 7};
 
 /********************/
 /* Static variables */
@@ -277,8 +297,12 @@ static Stream		stStreams [MAX_STREAMS];
 static int		stStreamCounter;
 // The array holding the ID numbers and object information
 // Routines that modify this array: MIO_IDAdd, MIO_IDFree, MIO_IDRemove
-static ID		stIDs [MAX_IDS];
+static ID		*stIDs;
+static int		stIDCapacity;
+// Slots in use or freed since the run started
 static int		stIDCounter;
+// Freed slots, oldest first
+static int		stIDFreeHead, stIDFreeTail;
 // Indicate whether to output debugging information
 static BOOL		stMoreInfo = FALSE;
 static BOOL		stErrorInfo = FALSE;
@@ -323,8 +347,10 @@ static void		MyWipeMIOFile (MIOFILE *pmMIOFile);
 /* The pmSysExitString parameter is used to specify a string to be	*/
 /* passed to MIOError_Abort that will cause Turing to abort, but will	*/
 /* intercepted by the environment and not produce an error message.	*/
+/*									*/
+/* Returns FALSE if there is no memory for the table of IDs.		*/
 /************************************************************************/
-void	MIO_Initialize (INSTANCE pmApplicationInstance, int pmOS,
+BOOL	MIO_Initialize (INSTANCE pmApplicationInstance, int pmOS,
 			const char *pmOOTDir, const char *pmHomeDir,
 		        BOOL pmCenterOutputWindow, BOOL pmStopUserClose,
 			const char *pmSysExitString)
@@ -340,15 +366,17 @@ void	MIO_Initialize (INSTANCE pmApplicationInstance, int pmOS,
     
     TL_TLI_TLIFCL = fclose;
     TL_TLI_TLIFOP = fopen;
-    TL_TLI_TLIFPC = fputc;
-    TL_TLI_TLIFPS = fputs;
-    TL_TLI_TLIFGC = fgetc;
-    TL_TLI_TLIFUG = ungetc;
+    // Standard input and output are read and written a block at a
+    // time, everything else goes straight to stdio.
+    TL_TLI_TLIFPC = TL_TLI_TLIBOC;
+    TL_TLI_TLIFPS = TL_TLI_TLIBOS;
+    TL_TLI_TLIFGC = TL_TLI_TLIBFG;
+    TL_TLI_TLIFUG = TL_TLI_TLIBFU;
     TL_TLI_TLIFSK = fseek;
     TL_TLI_TLIFTL = ftell;
-    TL_TLI_TLIFFL = fflush;
-    TL_TLI_TLIFRE = fread;
-    TL_TLI_TLIFWR = fwrite;
+    TL_TLI_TLIFFL = TL_TLI_TLIBOF;
+    TL_TLI_TLIFRE = TL_TLI_TLIBFR;
+    TL_TLI_TLIFWR = TL_TLI_TLIBOW;
     TL_TLI_TLIFZ  = rewind;
     
     // We are not yet executing a program
@@ -374,12 +402,22 @@ void	MIO_Initialize (INSTANCE pmApplicationInstance, int pmOS,
     }
     
     // Set all the ID's to 0
+    stIDs = (ID *) malloc (MAX_IDS * sizeof (ID));
+    if (stIDs == NULL)
+    {
+    	stIDCapacity = 0;
+    	return FALSE;
+    }
+    stIDCapacity = MAX_IDS;
     for (cnt = 0 ; cnt < MAX_IDS ; cnt++)
     {
     	stIDs [cnt].id = 0;
     }
     stIDCounter = 0;
+    stIDFreeHead = NO_SLOT;
+    stIDFreeTail = NO_SLOT;
 
+    return TRUE;
 } // MIO_Init
 
 
@@ -530,11 +568,13 @@ void	MIO_Finalize_Run (void)
     //
     // Free any previously allocated IDs and clear the open IDs
     //
-    for (cnt = 0 ; cnt < MAX_IDS ; cnt++)
+    for (cnt = 0 ; cnt < stIDCounter ; cnt++)
     {
     	MIO_IDFree (cnt);
     }
     stIDCounter = 0;
+    stIDFreeHead = NO_SLOT;
+    stIDFreeTail = NO_SLOT;
     // Finalize individual MIO modules
     MIOLexer_Finalize_Run ();
 } // MIO_Finalize_Run
@@ -894,6 +934,9 @@ return TRUE;
 /*   The id field of the stIDs array is positive when the slot is 	*/
 /* allocated to an ID and negative the same ID when the slot has been	*/
 /* freed. In that way Turing can detect an attempt to use a freed item.	*/
+/*   Freed slots are kept on a free list, oldest first, so a slot is	*/
+/* reused as late as possible.  Once the first MAX_IDS slots are all in	*/
+/* use, the table grows and the new slots get IDs from EXTRA_ID_BASE.	*/
 /************************************************************************/
 
 /************************************************************************/
@@ -904,76 +947,63 @@ return TRUE;
 /* appropriate base, the notifies the debugger that the item with 	*/
 /* that ID has been allocated.						*/
 /*   This routine should allocate a new slot number each time, 		*/
-/* incrementing the slot number each time an object is allocated.  In	*/
+/* using every slot once before reusing the one freed longest ago.  In	*/
 /* that way it is unlikely that using a freed ID number will mistakenly	*/
 /* use a current item with the same ID number.				*/ 
 /************************************************************************/
 int	MIO_IDAdd (int pmIDType, void *pmInfo, SRCPOS *pmSrcPos, 
 		   const char *pmDescription, void *pmCompareInfo)
 {
-    // Get first open id number
-    int	myInitialValue = stIDCounter;
+    int	mySlot, myKind;
     int	myIDNumber;
     
-    // If the current slot is not open, then we've already cycled once 
-    // around all the ID's
-    if (stIDs [stIDCounter].id > 0)
+    if ((stIDCounter >= MAX_IDS) && (stIDFreeHead != NO_SLOT))
     {
-    	// Look for an freed ID
-    	stIDCounter = (stIDCounter + 1) % MAX_IDS;
-        while (stIDCounter != myInitialValue)
-        {
-	    if (stIDs [stIDCounter].id < 0)
-	    {
-	    	break;
-	    }
-    	    stIDCounter = (stIDCounter + 1) % MAX_IDS;
-    	}
-    	if (stIDCounter == myInitialValue)
+    	// Reuse the slot that was freed longest ago
+    	mySlot = stIDFreeHead;
+    	stIDFreeHead = stIDs [mySlot].nextFree;
+    	if (stIDFreeHead == NO_SLOT)
     	{
-	    ABORT_WITH_ERRNO (E_OUT_OF_ITEM_IDS);
+    	    stIDFreeTail = NO_SLOT;
     	}
     }
-
-    if (pmIDType == FONT_ID)
-    {
-    	myIDNumber = stIDCounter + FONT_ID_BASE;
-    }
-    else if (pmIDType == DIR_ID)
-    {
-    	myIDNumber = stIDCounter + DIR_ID_BASE;
-    }
-    else if (pmIDType == PIC_ID)
-    {
-    	myIDNumber = stIDCounter + PIC_ID_BASE;
-    }
-    else if (pmIDType == SPRITE_ID)
-    {
-    	myIDNumber = stIDCounter + SPRITE_ID_BASE;
-    }
-    else if (pmIDType == LEXER_ID)
+    else
     {
-    	myIDNumber = stIDCounter + LEX_ID_BASE;
+    	// Use a slot that has never been used
+    	if (stIDCounter == stIDCapacity)
+    	{
+    	    ID	*myIDs;
+
+    	    myIDs = (ID *) realloc (stIDs, 2 * stIDCapacity * sizeof (ID));
+    	    if (myIDs == NULL)
+    	    {
+	    	ABORT_WITH_ERRNO (E_OUT_OF_ITEM_IDS);
+    	    }
+    	    stIDs = myIDs;
+    	    stIDCapacity *= 2;
+    	}
+    	mySlot = stIDCounter++;
     }
-	else if (pmIDType == HASHMAP_ID)
+
+    myKind = stIDTypeKinds [pmIDType - FONT_ID];
+    if (mySlot < MAX_IDS)
     {
-    	myIDNumber = stIDCounter + HASHMAP_ID_BASE;
+    	myIDNumber = FONT_ID_BASE + myKind * MAX_IDS + mySlot;
     }
     else
     {
-    	// TW Error!
+    	myIDNumber = EXTRA_ID_BASE + (mySlot - MAX_IDS) * NUM_ID_KINDS + 
+    		     myKind;
     }
 
-    stIDs [stIDCounter].id = myIDNumber;
-    stIDs [stIDCounter].type = pmIDType;
-    stIDs [stIDCounter].count = 1;
-    stIDs [stIDCounter].info = pmInfo;
-    stIDs [stIDCounter].compareInfo = pmCompareInfo;
+    stIDs [mySlot].id = myIDNumber;
+    stIDs [mySlot].type = pmIDType;
+    stIDs [mySlot].count = 1;
+    stIDs [mySlot].info = pmInfo;
+    stIDs [mySlot].compareInfo = pmCompareInfo;
     EdInt_NotifyDebuggerObjectAllocated (pmIDType, myIDNumber, 
 					 pmSrcPos, pmDescription);
         
-    stIDCounter = (stIDCounter + 1) % MAX_IDS;
-
     return (myIDNumber);    
 } // MIO_IDAdd
 
@@ -987,7 +1017,7 @@ int	MIO_IDCompare (int pmIDType, void *pmInfo, int pmInfoSize)
 {
     int		mySlotNumber;
     
-    for (mySlotNumber = 0 ; mySlotNumber < MAX_IDS ; mySlotNumber++)
+    for (mySlotNumber = 0 ; mySlotNumber < stIDCounter ; mySlotNumber++)
     {
 	if ((stIDs [mySlotNumber].id > 0) && 
 	    (stIDs [mySlotNumber].type == pmIDType))
@@ -1066,6 +1096,12 @@ void	MIO_IDFree (int pmSlotNumber)
 		case HASHMAP_ID:
     		MIOHashmap_Free (myIDNumber);
 		break;
+	    case LONGSTR_ID:
+    		MIOLongStr_Free (myIDNumber);
+		break;
+	    case INTMAP_ID:
+    		MIOIntMap_Free (myIDNumber);
+		break;
 	    default:
     		// TW - Abort!
 		break;
@@ -1135,6 +1171,18 @@ void	*MIO_IDGet (int pmIDNumber, int pmIDType)
 		myKindWhat = "created";
     	    	myMessageNumber = E_SPRITE_NOT_AN_ID;
 		break;
+    	    case LONGSTR_ID:
+		myFirstPart = "long string ID";
+		myKind = "long string";
+		myKindWhat = "created";
+    	    	myMessageNumber = E_LONGSTR_NOT_AN_ID;
+		break;
+    	    case INTMAP_ID:
+		myFirstPart = "int map ID";
+		myKind = "int map";
+		myKindWhat = "created";
+    	    	myMessageNumber = E_INTMAP_NOT_AN_ID;
+		break;
 	}
     	switch (myActualIDType)
     	{
@@ -1156,6 +1204,12 @@ void	*MIO_IDGet (int pmIDNumber, int pmIDType)
 		case HASHMAP_ID:
 		mySecondPart = "hashmap ID";
 		break;
+    	    case LONGSTR_ID:
+		mySecondPart = "long string ID";
+		break;
+    	    case INTMAP_ID:
+		mySecondPart = "int map ID";
+		break;
 	}
 
 	if (myActualIDType == UNKNOWN_ID)
@@ -1209,6 +1263,12 @@ void	*MIO_IDGet (int pmIDNumber, int pmIDType)
 			case HASHMAP_ID:
 	    	ABORT_WITH_ERRNO (E_HASHMAP_FREED);
     	        break;
+    	    case LONGSTR_ID:
+	    	ABORT_WITH_ERRNO (E_LONGSTR_FREED);
+    	        break;
+    	    case INTMAP_ID:
+	    	ABORT_WITH_ERRNO (E_INTMAP_FREED);
+    	        break;
     	} // switch
     }
     else 
@@ -1233,6 +1293,12 @@ void	*MIO_IDGet (int pmIDNumber, int pmIDType)
 			case HASHMAP_ID:
 	    	ABORT_WITH_ERRNO (E_HASHMAP_NEVER_INITIALIZED);
     	        break;
+    	    case LONGSTR_ID:
+	    	ABORT_WITH_ERRNO (E_LONGSTR_NEVER_NEWED);
+    	        break;
+    	    case INTMAP_ID:
+	    	ABORT_WITH_ERRNO (E_INTMAP_NEVER_NEWED);
+    	        break;
     	} // switch
     }
     
@@ -1295,6 +1361,18 @@ void	MIO_IDRemove (int pmIDNumber, int pmIDType)
 
     stIDs [myIDSlot].id = -stIDs [myIDSlot].id;
     stIDs [myIDSlot].info = NULL;
+
+    // Put the slot at the end of the free list
+    stIDs [myIDSlot].nextFree = NO_SLOT;
+    if (stIDFreeTail == NO_SLOT)
+    {
+    	stIDFreeHead = myIDSlot;
+    }
+    else
+    {
+    	stIDs [stIDFreeTail].nextFree = myIDSlot;
+    }
+    stIDFreeTail = myIDSlot;
 } // MIO_IDRemove
 
 
@@ -1815,40 +1893,19 @@ static void	MyGetIDSlot (int pmIDNumber, int *pmIDType, int *pmIDSlot)
     int		myActualIDType, myActualIDSlot;
 
     if ((FONT_ID_BASE <= pmIDNumber) && 
-    	(pmIDNumber < FONT_ID_BASE + MAX_IDS))
-    {    	 
-        myActualIDType = FONT_ID;
-        myActualIDSlot = pmIDNumber - FONT_ID_BASE;
-    }
-    else if ((DIR_ID_BASE <= pmIDNumber) && 
-    	(pmIDNumber < DIR_ID_BASE + MAX_IDS))
-    {    	 
-        myActualIDType = DIR_ID;
-        myActualIDSlot = pmIDNumber - DIR_ID_BASE;
-    }
-    else if ((PIC_ID_BASE <= pmIDNumber) && 
-    	(pmIDNumber < PIC_ID_BASE + MAX_IDS))
-    {    	 
-        myActualIDType = PIC_ID;
-        myActualIDSlot = pmIDNumber - PIC_ID_BASE;
-    }
-    else if ((SPRITE_ID_BASE <= pmIDNumber) && 
-    	(pmIDNumber < SPRITE_ID_BASE + MAX_IDS))
-    {    	 
-        myActualIDType = SPRITE_ID;
-        myActualIDSlot = pmIDNumber - SPRITE_ID_BASE;
-    }
-    else if ((LEX_ID_BASE <= pmIDNumber) && 
-    	(pmIDNumber < LEX_ID_BASE + MAX_IDS))
+    	(pmIDNumber < FONT_ID_BASE + NUM_ID_KINDS * MAX_IDS))
     {    	 
-        myActualIDType = LEXER_ID;
-        myActualIDSlot = pmIDNumber - LEX_ID_BASE;
+        myActualIDType = stIDKindTypes [(pmIDNumber - FONT_ID_BASE) / MAX_IDS];
+        myActualIDSlot = (pmIDNumber - FONT_ID_BASE) % MAX_IDS;
     }
-	else if ((HASHMAP_ID_BASE <= pmIDNumber) && 
-    	(pmIDNumber < HASHMAP_ID_BASE + MAX_IDS))
+    else if ((EXTRA_ID_BASE <= pmIDNumber) && 
+    	((pmIDNumber - EXTRA_ID_BASE) / NUM_ID_KINDS < 
+    	 stIDCounter - MAX_IDS))
     {    	 
-        myActualIDType = HASHMAP_ID;
-        myActualIDSlot = pmIDNumber - HASHMAP_ID_BASE;
+        myActualIDType = stIDKindTypes [(pmIDNumber - EXTRA_ID_BASE) % 
+        				NUM_ID_KINDS];
+        myActualIDSlot = MAX_IDS + (pmIDNumber - EXTRA_ID_BASE) / 
+        		 NUM_ID_KINDS;
     }
     else if (pmIDNumber == 0)
     {
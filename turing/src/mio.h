@@ -66,6 +66,8 @@
 #define UNKNOWN_ID			25
 #define ZERO_ID				26
 #define HASHMAP_ID			27
+#define LONGSTR_ID			28
+#define INTMAP_ID			29
 
 /*********/
 /* Types */
@@ -99,7 +101,7 @@ extern char		*MIO_programName;
 /***********************/
 /* External procedures */
 /***********************/
-extern void	MIO_Initialize (			    // Called by edrun
+extern BOOL	MIO_Initialize (			    // Called by edrun
 				INSTANCE pmApplicationInstance, int pmOS,
 				const char *pmOOTDir, const char *pmHomeDir,
 			        BOOL pmCenterOutputWindow, 
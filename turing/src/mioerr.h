@@ -41,6 +41,8 @@
 #define STR_ERROR_BASE		2800
 #define CRYPTO_ERROR_BASE	2900
 #define HASHMAP_ERROR_BASE	3000
+#define LONGSTR_ERROR_BASE	3100
+#define INTMAP_ERROR_BASE	3200
 
 // None
 enum NoErrorMessage
@@ -138,6 +140,11 @@ enum StreamErrorMessages
     E_STREAM_CLOSED,
     E_STREAM_TOO_MANY_OPEN,
     E_STREAM_ILLEGAL_OPERATION,
+    E_STREAM_BAD_INTEGER,
+    E_STREAM_BAD_REAL,
+    E_STREAM_LINE_TOO_LONG,
+    E_STREAM_BAD_WRITE_SIZE,
+    E_STREAM_BAD_READ_COUNT,
     E_Z_LAST_STREAM_ERROR
 };
 
@@ -464,6 +471,7 @@ enum HashmapErrorMessages
     E_HASHMAP_STREAM_ALREADY_OPEN,
     E_HASHMAP_TABLE_ERROR,
     E_HASHMAP_FREED,
+    E_HASHMAP_BAD_SIZE,
     E_Z_LAST_HASHMAP_ERROR
 };
 
@@ -576,6 +584,32 @@ enum CryptoErrorMessages
     E_Z_LAST_CRYPTO_ERROR 
 };
 
+// Long strings
+enum LongStrErrorMessages
+{
+    E_Z_FIRST_LONGSTR_ERROR = LONGSTR_ERROR_BASE - 1,
+    E_LONGSTR_UNKNOWN_ERROR,
+    E_LONGSTR_NOT_AN_ID,
+    E_LONGSTR_NEVER_NEWED,
+    E_LONGSTR_FREED,
+    E_LONGSTR_BAD_SUBSTRING,
+    E_LONGSTR_SUBSTRING_TOO_LONG,
+    E_Z_LAST_LONGSTR_ERROR
+};
+
+// Int maps and int sets
+enum IntMapErrorMessages
+{
+    E_Z_FIRST_INTMAP_ERROR = INTMAP_ERROR_BASE - 1,
+    E_INTMAP_UNKNOWN_ERROR,
+    E_INTMAP_NOT_AN_ID,
+    E_INTMAP_NEVER_NEWED,
+    E_INTMAP_FREED,
+    E_INTMAP_BAD_KEY,
+    E_INTMAP_BAD_SIZE,
+    E_Z_LAST_INTMAP_ERROR
+};
+
 #endif /* #ifndef _MIOERR_H_ */
 
 
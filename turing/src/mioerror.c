@@ -94,6 +94,9 @@ static struct ErrorCheck stErrorTypes [] =
     {E_Z_FIRST_INI_FILE_ERROR, E_Z_LAST_INI_FILE_ERROR, sizeof (iniFileErrMsg), sizeof (iniFileErrStr)},
     {E_Z_FIRST_STR_ERROR, E_Z_LAST_STR_ERROR, sizeof (strErrMsg), sizeof (strErrStr)},
     {E_Z_FIRST_CRYPTO_ERROR, E_Z_LAST_CRYPTO_ERROR, sizeof (cryptoErrMsg), sizeof (cryptoErrStr)},
+    {E_Z_FIRST_HASHMAP_ERROR, E_Z_LAST_HASHMAP_ERROR, sizeof (hashmapErrMsg), sizeof (hashmapErrStr)},
+    {E_Z_FIRST_LONGSTR_ERROR, E_Z_LAST_LONGSTR_ERROR, sizeof (longStrErrMsg), sizeof (longStrErrStr)},
+    {E_Z_FIRST_INTMAP_ERROR, E_Z_LAST_INTMAP_ERROR, sizeof (intMapErrMsg), sizeof (intMapErrStr)},
 };
 static int	stNumErrorTypes; 
 static int	stNumErrors [100];
@@ -95,6 +95,10 @@ extern OOTint MIOHashmap_New (SRCPOS *pmSrcPos)
 	OOTint myID;
 
 	newmap = newHashmap(32); // arbitrary size hint
+	if (newmap == NULL)
+	{
+		ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+	}
 
 	myID = MIO_IDAdd (HASHMAP_ID, newmap, pmSrcPos, "Hashmap", NULL); //comparison bit is set to "Hasmap" just because
 
@@ -110,41 +114,76 @@ extern OOTint MIOHashmap_New (SRCPOS *pmSrcPos)
 extern void	MIOHashmap_Put (OOTint pmMapID, OOTstring key,OOTint value)
 {
 	hashmap *myMap;
-	OOTint *putval;
-
-	putval	= (OOTint*)malloc(sizeof(OOTint));
-	*putval = value;
 
 	myMap = (hashmap *)MIO_IDGet (pmMapID, HASHMAP_ID);
 
-	hashmapSet(myMap,putval,key);
+	if (hashmapSet(myMap,value,key) == HASHMAP_NO_MEMORY)
+	{
+		ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+	}
 }
 extern OOTint	MIOHashmap_Get (OOTint pmMapID, OOTstring key, OOTint *result)
 {
 	hashmap *myMap = (hashmap*)MIO_IDGet (pmMapID, HASHMAP_ID);
 
-	OOTint *retrieved;
-	retrieved = (OOTint*)hashmapGet (myMap,key);
-
-	if(retrieved == NULL) {
+	if(!hashmapGet (myMap,key,result)) {
 		*result = 0;
 		return 0; // 0 if not found
-	} else {
-		*result = *retrieved;
-		return 1; 
 	}
-
-	
+	return 1;
 }
 extern void	MIOHashmap_Remove (OOTint pmMapID, OOTstring key)
 {
 	hashmap *myMap = (hashmap*)MIO_IDGet (pmMapID, HASHMAP_ID);
-	OOTint *retrieved;
 
-	retrieved = (OOTint*)hashmapRemove (myMap,key);
+	hashmapRemove (myMap,key);
+}
+extern void	MIOHashmap_Reserve (OOTint pmMapID, OOTint count)
+{
+	hashmap *myMap = (hashmap*)MIO_IDGet (pmMapID, HASHMAP_ID);
 
-	if(retrieved != NULL) {
-		free(retrieved);
+	if (count < 0 || count > HASHMAP_MAX_RESERVE)
+	{
+		ABORT_WITH_ERRMSG (E_HASHMAP_BAD_SIZE,
+				   "Number of keys to reserve (%d) is out of range 0 .. %d",
+				   count, HASHMAP_MAX_RESERVE);
+	}
+	if (!hashmapReserve (myMap,(unsigned int)count))
+	{
+		ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
 	}
-	
+}
+extern OOTint	MIOHashmap_Size (OOTint pmMapID)
+{
+	hashmap *myMap = (hashmap*)MIO_IDGet (pmMapID, HASHMAP_ID);
+
+	return (OOTint)hashmapCount (myMap);
+}
+extern void	MIOHashmap_Clear (OOTint pmMapID)
+{
+	hashmap *myMap = (hashmap*)MIO_IDGet (pmMapID, HASHMAP_ID);
+
+	hashmapClear (myMap);
+}
+// First and Next copy out the key and value, or leave them alone and
+// return 0 once every key has been seen.
+extern OOTint	MIOHashmap_First (OOTint pmMapID, OOTstring key, OOTint *value)
+{
+	hashmap *myMap = (hashmap*)MIO_IDGet (pmMapID, HASHMAP_ID);
+	const char *myKey;
+
+	if (!hashmapFirst (myMap,&myKey,value))
+		return 0;
+	strcpy (key,myKey);
+	return 1;
+}
+extern OOTint	MIOHashmap_Next (OOTint pmMapID, OOTstring key, OOTint *value)
+{
+	hashmap *myMap = (hashmap*)MIO_IDGet (pmMapID, HASHMAP_ID);
+	const char *myKey;
+
+	if (!hashmapNext (myMap,&myKey,value))
+		return 0;
+	strcpy (key,myKey);
+	return 1;
 }
@@ -39,6 +39,11 @@ extern void	MIOHashmap_Free (OOTint pmFontID);
 extern void	MIOHashmap_Put (OOTint pmMapID, OOTstring key,OOTint value);
 extern OOTint	MIOHashmap_Get (OOTint pmMapID, OOTstring key, OOTint *result);
 extern void	MIOHashmap_Remove (OOTint pmMapID, OOTstring key);
+extern void	MIOHashmap_Reserve (OOTint pmMapID, OOTint count);
+extern OOTint	MIOHashmap_Size (OOTint pmMapID);
+extern void	MIOHashmap_Clear (OOTint pmMapID);
+extern OOTint	MIOHashmap_First (OOTint pmMapID, OOTstring key, OOTint *value);
+extern OOTint	MIOHashmap_Next (OOTint pmMapID, OOTstring key, OOTint *value);
 
 /***************************************/
 /* External procedures for MIO library */
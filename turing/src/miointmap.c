@@ -0,0 +1,226 @@
+/***************/
+/* miointmap.c */
+/***************/
+
+/*******************/
+/* System includes */
+/*******************/
+
+/****************/
+/* Self include */
+/****************/
+#include "miointmap.h"
+
+/******************/
+/* Other includes */
+/******************/
+#include "mio.h"
+
+#include "intmap.h"
+
+#include "mioerr.h"
+
+// Test to make certain we're not accidentally including <windows.h> which
+// might allow for windows contamination of platform independent code.
+#ifdef _INC_WINDOWS
+xxx
+#endif
+
+/**********/
+/* Macros */
+/**********/
+
+/*************/
+/* Constants */
+/*************/
+#define INITIAL_KEYS	16
+
+/********************/
+/* Global variables */
+/********************/
+
+/*********/
+/* Types */
+/*********/
+
+/**********************/
+/* External variables */
+/**********************/
+
+/********************/
+/* Static constants */
+/********************/
+
+/********************/
+/* Static variables */
+/********************/
+
+/******************************/
+/* Static callback procedures */
+/******************************/
+
+/*********************/
+/* Static procedures */
+/*********************/
+static intmap	*MyGetIntMap (OOTint pmMapID);
+
+
+/*********************************************/
+/* External procedures for Turing predefines */
+/*********************************************/
+/************************************************************************/
+/* MIOIntMap_New							*/
+/*									*/
+/* Both IntIntMap and IntSet are int maps; a set just never looks at	*/
+/* its values.								*/
+/************************************************************************/
+OOTint	MIOIntMap_New (SRCPOS *pmSrcPos, const char *pmDescription)
+{
+    intmap	*myMap;
+    OOTint	myID;
+
+    myMap = newIntmap (INITIAL_KEYS);
+    if (myMap == NULL)
+    {
+	ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+    }
+
+    myID = MIO_IDAdd (INTMAP_ID, myMap, pmSrcPos, pmDescription, NULL);
+
+    // Couldn't allocate an identifier.
+    if (myID == 0)
+    {
+	deleteIntmap (myMap);
+    }
+
+    return myID;
+} // MIOIntMap_New
+
+
+/************************************************************************/
+/* MIOIntMap_Free							*/
+/************************************************************************/
+void	MIOIntMap_Free (OOTint pmMapID)
+{
+    if (MIO_IDGetCount (pmMapID, INTMAP_ID) > 1)
+    {
+	MIO_IDDecrement (pmMapID);
+    }
+    else
+    {
+	deleteIntmap (MyGetIntMap (pmMapID));
+	MIO_IDRemove (pmMapID, INTMAP_ID);
+    }
+} // MIOIntMap_Free
+
+
+/************************************************************************/
+/* MIOIntMap_Put							*/
+/************************************************************************/
+void	MIOIntMap_Put (OOTint pmMapID, OOTint pmKey, OOTint pmValue)
+{
+    intmap	*myMap = MyGetIntMap (pmMapID);
+
+    if (pmKey == INTMAP_NO_KEY)
+    {
+	ABORT_WITH_ERRNO (E_INTMAP_BAD_KEY);
+    }
+    if (intmapSet (myMap, pmKey, pmValue) == INTMAP_NO_MEMORY)
+    {
+	ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+    }
+} // MIOIntMap_Put
+
+
+/************************************************************************/
+/* MIOIntMap_Get							*/
+/*									*/
+/* Like IntHashMap.Get, the result is 0 when the key is not in the map.	*/
+/************************************************************************/
+OOTboolean	MIOIntMap_Get (OOTint pmMapID, OOTint pmKey, OOTint *pmResult)
+{
+    if (!intmapGet (MyGetIntMap (pmMapID), pmKey, pmResult))
+    {
+	*pmResult = 0;
+	return FALSE;
+    }
+    return TRUE;
+} // MIOIntMap_Get
+
+
+/************************************************************************/
+/* MIOIntMap_Remove							*/
+/************************************************************************/
+void	MIOIntMap_Remove (OOTint pmMapID, OOTint pmKey)
+{
+    intmapRemove (MyGetIntMap (pmMapID), pmKey);
+} // MIOIntMap_Remove
+
+
+/************************************************************************/
+/* MIOIntMap_Contains							*/
+/************************************************************************/
+OOTboolean	MIOIntMap_Contains (OOTint pmMapID, OOTint pmKey)
+{
+    OOTint	myValue;
+
+    return (OOTboolean) intmapGet (MyGetIntMap (pmMapID), pmKey, &myValue);
+} // MIOIntMap_Contains
+
+
+/************************************************************************/
+/* MIOIntMap_Size							*/
+/************************************************************************/
+OOTint	MIOIntMap_Size (OOTint pmMapID)
+{
+    return (OOTint) intmapCount (MyGetIntMap (pmMapID));
+} // MIOIntMap_Size
+
+
+/************************************************************************/
+/* MIOIntMap_Clear							*/
+/************************************************************************/
+void	MIOIntMap_Clear (OOTint pmMapID)
+{
+    intmapClear (MyGetIntMap (pmMapID));
+} // MIOIntMap_Clear
+
+
+/************************************************************************/
+/* MIOIntMap_Reserve							*/
+/*									*/
+/* Make room for pmCount keys, so that adding them never has to grow	*/
+/* the table.  The table never shrinks.					*/
+/************************************************************************/
+void	MIOIntMap_Reserve (OOTint pmMapID, OOTint pmCount)
+{
+    intmap	*myMap = MyGetIntMap (pmMapID);
+
+    if ((pmCount < 0) || (pmCount > INTMAP_MAX_RESERVE))
+    {
+	ABORT_WITH_ERRMSG (E_INTMAP_BAD_SIZE,
+			   "Number of keys to reserve (%d) is out of range "
+			   "0 .. %d", pmCount, INTMAP_MAX_RESERVE);
+    }
+    if (!intmapReserve (myMap, (unsigned int) pmCount))
+    {
+	ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+    }
+} // MIOIntMap_Reserve
+
+
+/***************************************/
+/* External procedures for MIO library */
+/***************************************/
+
+
+/*********************/
+/* Static procedures */
+/*********************/
+/************************************************************************/
+/* MyGetIntMap								*/
+/************************************************************************/
+static intmap	*MyGetIntMap (OOTint pmMapID)
+{
+    return (intmap *) MIO_IDGet (pmMapID, INTMAP_ID);
+} // MyGetIntMap
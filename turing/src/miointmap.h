@@ -0,0 +1,52 @@
+/***************/
+/* miointmap.h */
+/***************/
+
+#ifndef _MIOINTMAP_H_
+#define _MIOINTMAP_H_
+
+/*******************/
+/* System includes */
+/*******************/
+
+/******************/
+/* Other includes */
+/******************/
+#include "miotypes.h"
+
+/**********/
+/* Macros */
+/**********/
+
+/*************/
+/* Constants */
+/*************/
+
+/*********/
+/* Types */
+/*********/
+
+/**********************/
+/* External variables */
+/**********************/
+
+/*********************************************/
+/* External procedures for Turing predefines */
+/*********************************************/
+extern OOTint	MIOIntMap_New (SRCPOS *pmSrcPos, const char *pmDescription);
+extern void	MIOIntMap_Free (OOTint pmMapID);
+
+extern void	MIOIntMap_Put (OOTint pmMapID, OOTint pmKey, OOTint pmValue);
+extern OOTboolean MIOIntMap_Get (OOTint pmMapID, OOTint pmKey,
+				 OOTint *pmResult);
+extern void	MIOIntMap_Remove (OOTint pmMapID, OOTint pmKey);
+extern OOTboolean MIOIntMap_Contains (OOTint pmMapID, OOTint pmKey);
+extern OOTint	MIOIntMap_Size (OOTint pmMapID);
+extern void	MIOIntMap_Clear (OOTint pmMapID);
+extern void	MIOIntMap_Reserve (OOTint pmMapID, OOTint pmCount);
+
+/***************************************/
+/* External procedures for MIO library */
+/***************************************/
+
+#endif // #ifndef _MIOINTMAP_H_
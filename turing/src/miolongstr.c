@@ -0,0 +1,441 @@
+/****************/
+/* miolongstr.c */
+/****************/
+
+/*******************/
+/* System includes */
+/*******************/
+#include <stdlib.h>
+#include <string.h>
+
+/****************/
+/* Self include */
+/****************/
+#include "miolongstr.h"
+
+/******************/
+/* Other includes */
+/******************/
+#include "mio.h"
+
+#include "mioerr.h"
+
+// Test to make certain we're not accidentally including <windows.h> which
+// might allow for windows contamination of platform independent code.
+#ifdef _INC_WINDOWS
+xxx
+#endif
+
+/**********/
+/* Macros */
+/**********/
+
+/*************/
+/* Constants */
+/*************/
+#define INITIAL_CAPACITY	256
+// Doubling from INITIAL_CAPACITY reaches this exactly, and no length or
+// sum of two lengths that fit under it can overflow an int.
+#define MAX_CAPACITY		(1 << 30)
+
+/********************/
+/* Global variables */
+/********************/
+
+/*********/
+/* Types */
+/*********/
+// A long string keeps its length, so nothing is rescanned, and its
+// buffer grows by doubling, so building a string of n characters by
+// appending costs O(n) overall.  The buffer is always kept terminated
+// so it can be handed to the tlib output routines as is.
+typedef struct LongStr
+{
+    char	*data;
+    int		length;
+    int		capacity;
+} LongStr;
+
+/**********************/
+/* External variables */
+/**********************/
+
+/****************************/
+/* External procedures used */
+/****************************/
+extern int	TL_TLS_TLSVFD (char *pmBuf, int pmLen, char *pmPat, int pmPatLen);
+extern int	TL_TLS_TLSVCM (char *pmLeft, char *pmRight, int pmLen);
+extern int	TL_TLI_TLIGL (char *pmBuffer, int pmBufSize, short pmStreamNo);
+extern void	TL_TLI_TLIPC (int pmWidth, char *pmItem, int pmItemSize,
+			      short pmStreamNo);
+extern void	TL_TLI_TLISS (int pmStreamNo, int pmMode);
+
+/********************/
+/* Static constants */
+/********************/
+
+/********************/
+/* Static variables */
+/********************/
+
+/******************************/
+/* Static callback procedures */
+/******************************/
+
+/*********************/
+/* Static procedures */
+/*********************/
+static LongStr	*MyGetLongStr (OOTint pmLongStrID);
+static void	MyReserve (LongStr *pmLongStr, int pmExtra);
+static void	MyAppend (LongStr *pmLongStr, const char *pmChars, int pmLength);
+static void	MyCheckRange (LongStr *pmLongStr, OOTint pmFirst, OOTint pmLast);
+
+
+/*********************************************/
+/* External procedures for Turing predefines */
+/*********************************************/
+/************************************************************************/
+/* MIOLongStr_New							*/
+/************************************************************************/
+OOTint	MIOLongStr_New (SRCPOS *pmSrcPos)
+{
+    LongStr	*myLongStr;
+    OOTint	myID;
+
+    myLongStr = (LongStr *) malloc (sizeof (LongStr));
+    if (myLongStr == NULL)
+    {
+	ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+    }
+    myLongStr -> data = (char *) malloc (INITIAL_CAPACITY + 1);
+    if (myLongStr -> data == NULL)
+    {
+	free (myLongStr);
+	ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+    }
+    myLongStr -> data [0] = 0;
+    myLongStr -> length = 0;
+    myLongStr -> capacity = INITIAL_CAPACITY;
+
+    myID = MIO_IDAdd (LONGSTR_ID, myLongStr, pmSrcPos, "Long string", NULL);
+
+    // Couldn't allocate an identifier.
+    if (myID == 0)
+    {
+	free (myLongStr -> data);
+	free (myLongStr);
+    }
+
+    return myID;
+} // MIOLongStr_New
+
+
+/************************************************************************/
+/* MIOLongStr_Free							*/
+/************************************************************************/
+void	MIOLongStr_Free (OOTint pmLongStrID)
+{
+    LongStr	*myLongStr;
+
+    if (MIO_IDGetCount (pmLongStrID, LONGSTR_ID) > 1)
+    {
+	MIO_IDDecrement (pmLongStrID);
+    }
+    else
+    {
+	myLongStr = MyGetLongStr (pmLongStrID);
+	free (myLongStr -> data);
+	free (myLongStr);
+	MIO_IDRemove (pmLongStrID, LONGSTR_ID);
+    }
+} // MIOLongStr_Free
+
+
+/************************************************************************/
+/* MIOLongStr_Length							*/
+/************************************************************************/
+OOTint	MIOLongStr_Length (OOTint pmLongStrID)
+{
+    return MyGetLongStr (pmLongStrID) -> length;
+} // MIOLongStr_Length
+
+
+/************************************************************************/
+/* MIOLongStr_Clear							*/
+/************************************************************************/
+void	MIOLongStr_Clear (OOTint pmLongStrID)
+{
+    LongStr	*myLongStr = MyGetLongStr (pmLongStrID);
+
+    myLongStr -> length = 0;
+    myLongStr -> data [0] = 0;
+} // MIOLongStr_Clear
+
+
+/************************************************************************/
+/* MIOLongStr_Assign							*/
+/************************************************************************/
+void	MIOLongStr_Assign (OOTint pmLongStrID, OOTstring pmStr)
+{
+    LongStr	*myLongStr = MyGetLongStr (pmLongStrID);
+
+    myLongStr -> length = 0;
+    MyAppend (myLongStr, pmStr, strlen (pmStr));
+} // MIOLongStr_Assign
+
+
+/************************************************************************/
+/* MIOLongStr_Append							*/
+/************************************************************************/
+void	MIOLongStr_Append (OOTint pmLongStrID, OOTstring pmStr)
+{
+    MyAppend (MyGetLongStr (pmLongStrID), pmStr, strlen (pmStr));
+} // MIOLongStr_Append
+
+
+/************************************************************************/
+/* MIOLongStr_AppendLong						*/
+/************************************************************************/
+void	MIOLongStr_AppendLong (OOTint pmLongStrID, OOTint pmOtherID)
+{
+    LongStr	*myLongStr = MyGetLongStr (pmLongStrID);
+    LongStr	*myOther = MyGetLongStr (pmOtherID);
+
+    // Reserve first: appending a string to itself must not read from a
+    // buffer that has just been reallocated.
+    MyReserve (myLongStr, myOther -> length);
+    MyAppend (myLongStr, myOther -> data, myOther -> length);
+} // MIOLongStr_AppendLong
+
+
+/************************************************************************/
+/* MIOLongStr_Sub							*/
+/*									*/
+/* Copy s (first .. last) into an ordinary string.			*/
+/************************************************************************/
+void	MIOLongStr_Sub (OOTint pmLongStrID, OOTint pmFirst, OOTint pmLast,
+			OOTstring pmResult)
+{
+    LongStr	*myLongStr = MyGetLongStr (pmLongStrID);
+    int		myLength;
+
+    MyCheckRange (myLongStr, pmFirst, pmLast);
+    myLength = pmLast - pmFirst + 1;
+    if (myLength > 255)
+    {
+	pmResult [0] = 0;
+	ABORT_WITH_ERRNO (E_LONGSTR_SUBSTRING_TOO_LONG);
+	return;
+    }
+    memcpy (pmResult, myLongStr -> data + pmFirst - 1, myLength);
+    pmResult [myLength] = 0;
+} // MIOLongStr_Sub
+
+
+/************************************************************************/
+/* MIOLongStr_SubLong							*/
+/*									*/
+/* Copy s (first .. last) into a new long string.			*/
+/************************************************************************/
+OOTint	MIOLongStr_SubLong (OOTint pmLongStrID, OOTint pmFirst, OOTint pmLast,
+			    SRCPOS *pmSrcPos)
+{
+    LongStr	*myLongStr = MyGetLongStr (pmLongStrID);
+    OOTint	myID;
+
+    MyCheckRange (myLongStr, pmFirst, pmLast);
+    myID = MIOLongStr_New (pmSrcPos);
+    if (myID != 0)
+    {
+	MyAppend (MyGetLongStr (myID), myLongStr -> data + pmFirst - 1,
+		  pmLast - pmFirst + 1);
+    }
+    return myID;
+} // MIOLongStr_SubLong
+
+
+/************************************************************************/
+/* MIOLongStr_Index							*/
+/*									*/
+/* Position of the first occurrence of pattern at or after start, or 0.	*/
+/************************************************************************/
+OOTint	MIOLongStr_Index (OOTint pmLongStrID, OOTstring pmPattern,
+			  OOTint pmStart)
+{
+    LongStr	*myLongStr = MyGetLongStr (pmLongStrID);
+    int		myPatternLength = strlen (pmPattern);
+    int		myPos;
+
+    if (pmStart < 1)
+    {
+	pmStart = 1;
+    }
+    if (pmStart - 1 + myPatternLength > myLongStr -> length)
+    {
+	return 0;
+    }
+    if (myPatternLength == 0)
+    {
+	return pmStart;
+    }
+    myPos = TL_TLS_TLSVFD (myLongStr -> data + pmStart - 1,
+			   myLongStr -> length - pmStart + 1,
+			   pmPattern, myPatternLength);
+    if (myPos < 0)
+    {
+	return 0;
+    }
+    return pmStart + myPos;
+} // MIOLongStr_Index
+
+
+/************************************************************************/
+/* MIOLongStr_Compare							*/
+/*									*/
+/* Negative, zero or positive as the first string orders before, the	*/
+/* same as or after the second, the same way as the string operators.	*/
+/************************************************************************/
+OOTint	MIOLongStr_Compare (OOTint pmLongStrID, OOTint pmOtherID)
+{
+    LongStr	*myLeft = MyGetLongStr (pmLongStrID);
+    LongStr	*myRight = MyGetLongStr (pmOtherID);
+    int		myCommon, myDiff;
+
+    myCommon = (myLeft -> length < myRight -> length) ?
+	       myLeft -> length : myRight -> length;
+    myDiff = TL_TLS_TLSVCM (myLeft -> data, myRight -> data, myCommon);
+    if (myDiff < myCommon)
+    {
+	return (unsigned char) myLeft -> data [myDiff] -
+	       (unsigned char) myRight -> data [myDiff];
+    }
+    return myLeft -> length - myRight -> length;
+} // MIOLongStr_Compare
+
+
+/************************************************************************/
+/* MIOLongStr_GetLine							*/
+/*									*/
+/* Replace the contents with the next line of any length from the tlib	*/
+/* stream.  Returns false, leaving the string empty, at end of file.	*/
+/************************************************************************/
+OOTboolean MIOLongStr_GetLine (OOTint pmLongStrID, OOTint pmTLStream)
+{
+    LongStr	*myLongStr = MyGetLongStr (pmLongStrID);
+    int		myRoom, myRead;
+
+    myLongStr -> length = 0;
+    myLongStr -> data [0] = 0;
+    TL_TLI_TLISS (pmTLStream, 1);
+    for (;;)
+    {
+	myRoom = myLongStr -> capacity - myLongStr -> length;
+	myRead = TL_TLI_TLIGL (myLongStr -> data + myLongStr -> length,
+			       myRoom, (short) pmTLStream);
+	if (myRead < 0)
+	{
+	    // End of file: only a failure if nothing at all was read
+	    return (OOTboolean) (myLongStr -> length > 0);
+	}
+	myLongStr -> length += myRead;
+	myLongStr -> data [myLongStr -> length] = 0;
+	if (myRead < myRoom)
+	{
+	    return TRUE;
+	}
+	MyReserve (myLongStr, 1);
+    }
+} // MIOLongStr_GetLine
+
+
+/************************************************************************/
+/* MIOLongStr_Put							*/
+/************************************************************************/
+void	MIOLongStr_Put (OOTint pmLongStrID, OOTint pmTLStream)
+{
+    LongStr	*myLongStr = MyGetLongStr (pmLongStrID);
+
+    TL_TLI_TLISS (pmTLStream, 2);
+    TL_TLI_TLIPC (0, myLongStr -> data, myLongStr -> length,
+		  (short) pmTLStream);
+} // MIOLongStr_Put
+
+
+/***************************************/
+/* External procedures for MIO library */
+/***************************************/
+
+
+/*********************/
+/* Static procedures */
+/*********************/
+/************************************************************************/
+/* MyGetLongStr								*/
+/************************************************************************/
+static LongStr	*MyGetLongStr (OOTint pmLongStrID)
+{
+    return (LongStr *) MIO_IDGet (pmLongStrID, LONGSTR_ID);
+} // MyGetLongStr
+
+
+/************************************************************************/
+/* MyReserve								*/
+/*									*/
+/* Make room for pmExtra more characters plus the terminator.  Past	*/
+/* MAX_CAPACITY this fails as if out of memory.				*/
+/************************************************************************/
+static void	MyReserve (LongStr *pmLongStr, int pmExtra)
+{
+    int		myCapacity = pmLongStr -> capacity;
+    int		myLength;
+    char	*myData;
+
+    if (pmExtra > MAX_CAPACITY - pmLongStr -> length)
+    {
+	ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+    }
+    myLength = pmLongStr -> length + pmExtra;
+    if (myLength <= myCapacity)
+    {
+	return;
+    }
+    while (myCapacity < myLength)
+    {
+	myCapacity *= 2;
+    }
+    myData = (char *) realloc (pmLongStr -> data, myCapacity + 1);
+    if (myData == NULL)
+    {
+	ABORT_WITH_ERRNO (E_INSUFFICIENT_MEMORY);
+    }
+    pmLongStr -> data = myData;
+    pmLongStr -> capacity = myCapacity;
+} // MyReserve
+
+
+/************************************************************************/
+/* MyAppend								*/
+/************************************************************************/
+static void	MyAppend (LongStr *pmLongStr, const char *pmChars, int pmLength)
+{
+    MyReserve (pmLongStr, pmLength);
+    memmove (pmLongStr -> data + pmLongStr -> length, pmChars, pmLength);
+    pmLongStr -> length += pmLength;
+    pmLongStr -> data [pmLongStr -> length] = 0;
+} // MyAppend
+
+
+/************************************************************************/
+/* MyCheckRange								*/
+/*									*/
+/* Same rule as for string substrings: 1 <= first <= last + 1 and	*/
+/* last <= length.							*/
+/************************************************************************/
+static void	MyCheckRange (LongStr *pmLongStr, OOTint pmFirst, OOTint pmLast)
+{
+    if ((pmFirst < 1) || (pmFirst > pmLast + 1) ||
+	(pmLast > pmLongStr -> length))
+    {
+	ABORT_WITH_ERRNO (E_LONGSTR_BAD_SUBSTRING);
+    }
+} // MyCheckRange
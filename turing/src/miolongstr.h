@@ -0,0 +1,58 @@
+/****************/
+/* miolongstr.h */
+/****************/
+
+#ifndef _MIOLONGSTR_H_
+#define _MIOLONGSTR_H_
+
+/*******************/
+/* System includes */
+/*******************/
+
+/******************/
+/* Other includes */
+/******************/
+#include "miotypes.h"
+
+/**********/
+/* Macros */
+/**********/
+
+/*************/
+/* Constants */
+/*************/
+
+/*********/
+/* Types */
+/*********/
+
+/**********************/
+/* External variables */
+/**********************/
+
+/*********************************************/
+/* External procedures for Turing predefines */
+/*********************************************/
+extern OOTint	MIOLongStr_New (SRCPOS *pmSrcPos);
+extern void	MIOLongStr_Free (OOTint pmLongStrID);
+
+extern OOTint	MIOLongStr_Length (OOTint pmLongStrID);
+extern void	MIOLongStr_Clear (OOTint pmLongStrID);
+extern void	MIOLongStr_Assign (OOTint pmLongStrID, OOTstring pmStr);
+extern void	MIOLongStr_Append (OOTint pmLongStrID, OOTstring pmStr);
+extern void	MIOLongStr_AppendLong (OOTint pmLongStrID, OOTint pmOtherID);
+extern void	MIOLongStr_Sub (OOTint pmLongStrID, OOTint pmFirst, OOTint pmLast,
+				OOTstring pmResult);
+extern OOTint	MIOLongStr_SubLong (OOTint pmLongStrID, OOTint pmFirst,
+				    OOTint pmLast, SRCPOS *pmSrcPos);
+extern OOTint	MIOLongStr_Index (OOTint pmLongStrID, OOTstring pmPattern,
+				  OOTint pmStart);
+extern OOTint	MIOLongStr_Compare (OOTint pmLongStrID, OOTint pmOtherID);
+extern OOTboolean MIOLongStr_GetLine (OOTint pmLongStrID, OOTint pmTLStream);
+extern void	MIOLongStr_Put (OOTint pmLongStrID, OOTint pmTLStream);
+
+/***************************************/
+/* External procedures for MIO library */
+/***************************************/
+
+#endif // #ifndef _MIOLONGSTR_H_
@@ -0,0 +1,355 @@
+/***************/
+/* miostream.c */
+/***************/
+
+/*******************/
+/* System includes */
+/*******************/
+#include <string.h>
+
+/****************/
+/* Self include */
+/****************/
+#include "miostream.h"
+
+/******************/
+/* Other includes */
+/******************/
+#include "mio.h"
+
+#include "mioerr.h"
+
+// Test to make certain we're not accidentally including <windows.h> which
+// might allow for windows contamination of platform independent code.
+#ifdef _INC_WINDOWS
+xxx
+#endif
+
+/**********/
+/* Macros */
+/**********/
+// The separators get uses between tokens
+#define IS_BLANK(c)	(((c) == ' ') || ((c) == '\t') || ((c) == '\f'))
+
+/*************/
+/* Constants */
+/*************/
+#define STRING_SIZE	256
+#define LINE_CHUNK	4096
+
+/********************/
+/* Global variables */
+/********************/
+
+/*********/
+/* Types */
+/*********/
+
+/**********************/
+/* External variables */
+/**********************/
+
+/****************************/
+/* External procedures used */
+/****************************/
+extern int	TL_TLI_TLIGL (char *pmBuffer, int pmBufSize, short pmStreamNo);
+extern void	TL_TLI_TLIRER (int *pmSizeRead, char *pmItem, int pmItemSize,
+			       int *pmStatus, short pmStreamNo);
+extern void	TL_TLI_TLISS (int pmStreamNo, int pmMode);
+extern void	TL_TLI_TLIPC (int pmWidth, char *pmItem, int pmItemSize,
+			      short pmStreamNo);
+extern void	TL_TLA_TLAVSI (char *pmSource, int pmBase, int *pmAnswer,
+			       char *pmError, int pmQuitOnError);
+extern void	TL_TLA_TLAVS8 (char *pmSource, double *pmAnswer,
+			       char *pmError, int pmQuitOnError);
+
+/********************/
+/* Static constants */
+/********************/
+
+/********************/
+/* Static variables */
+/********************/
+
+/******************************/
+/* Static callback procedures */
+/******************************/
+
+/*********************/
+/* Static procedures */
+/*********************/
+static OOTint	MyGetNumbers (OOTint pmTLStream, void *pmValues,
+			      OOTint pmMaxValues, BOOL pmReal);
+static void	MyCheckCount (OOTint pmCount, OOTint pmSize);
+static void	MyConvert (char *pmToken, int pmLength, void *pmValues,
+			   OOTint pmIndex, BOOL pmReal);
+
+
+/*********************************************/
+/* External procedures for Turing predefines */
+/*********************************************/
+/************************************************************************/
+/* MIOStream_ReadAll							*/
+/*									*/
+/* Read the rest of the stream, or as much of it as fits, into the	*/
+/* char array with a single read.  Returns the number of characters	*/
+/* read, which is zero at end of file.					*/
+/************************************************************************/
+OOTint	MIOStream_ReadAll (OOTint pmTLStream, char *pmChars, OOTint pmSize)
+{
+    int		myRead;
+
+    if (pmSize <= 0)
+    {
+	return 0;
+    }
+    TL_TLI_TLISS (pmTLStream, 1);
+    TL_TLI_TLIRER (&myRead, pmChars, pmSize, NULL, (short) pmTLStream);
+
+    return myRead;
+} // MIOStream_ReadAll
+
+
+/************************************************************************/
+/* MIOStream_ReadLines							*/
+/*									*/
+/* Read up to pmMaxLines lines into consecutive elements of a string	*/
+/* array of pmSize elements.  Returns the number read, which is less	*/
+/* than pmMaxLines only at end of file.  A line too long for a string	*/
+/* is an error, as it is for get s : *.					*/
+/************************************************************************/
+OOTint	MIOStream_ReadLines (OOTint pmTLStream, char *pmLines,
+			     OOTint pmSize, OOTint pmMaxLines)
+{
+    char	*myLine;
+    OOTint	myCount;
+    int		myRead;
+
+    MyCheckCount (pmMaxLines, pmSize);
+    TL_TLI_TLISS (pmTLStream, 1);
+    for (myCount = 0; myCount < pmMaxLines; myCount++)
+    {
+	myLine = pmLines + myCount * STRING_SIZE;
+	myRead = TL_TLI_TLIGL (myLine, STRING_SIZE, (short) pmTLStream);
+	if (myRead < 0)
+	{
+	    break;
+	}
+	if (myRead == STRING_SIZE)
+	{
+	    myLine [STRING_SIZE - 1] = 0;
+	    ABORT_WITH_ERRMSG (E_STREAM_LINE_TOO_LONG,
+			       "Input string too large for string variable");
+	}
+	myLine [myRead] = 0;
+    }
+
+    return myCount;
+} // MIOStream_ReadLines
+
+
+/************************************************************************/
+/* MIOStream_GetInts							*/
+/*									*/
+/* Read one line of any length and convert each token on it as get	*/
+/* would.  Returns the number of values on the line, of which the	*/
+/* first pmMaxValues are stored, or -1 at end of file.			*/
+/************************************************************************/
+OOTint	MIOStream_GetInts (OOTint pmTLStream, OOTint *pmValues,
+			   OOTint pmSize, OOTint pmMaxValues)
+{
+    MyCheckCount (pmMaxValues, pmSize);
+    return MyGetNumbers (pmTLStream, pmValues, pmMaxValues, FALSE);
+} // MIOStream_GetInts
+
+
+/************************************************************************/
+/* MIOStream_GetReals							*/
+/************************************************************************/
+OOTint	MIOStream_GetReals (OOTint pmTLStream, OOTreal *pmValues,
+			    OOTint pmSize, OOTint pmMaxValues)
+{
+    MyCheckCount (pmMaxValues, pmSize);
+    return MyGetNumbers (pmTLStream, pmValues, pmMaxValues, TRUE);
+} // MIOStream_GetReals
+
+
+/************************************************************************/
+/* MIOStream_Write							*/
+/*									*/
+/* Put the first pmNumChars characters of a char array as one item, the	*/
+/* way put of a char(n) is, so they reach the output buffer in a single	*/
+/* copy instead of one put per character.				*/
+/************************************************************************/
+void	MIOStream_Write (OOTint pmTLStream, char *pmChars, OOTint pmSize,
+			 OOTint pmNumChars)
+{
+    if ((pmNumChars < 0) || (pmNumChars > pmSize))
+    {
+	ABORT_WITH_ERRMSG (E_STREAM_BAD_WRITE_SIZE,
+			   "Number of characters to write (%d) is out of "
+			   "range 0 .. %d", pmNumChars, pmSize);
+    }
+    TL_TLI_TLISS (pmTLStream, 2);
+    TL_TLI_TLIPC (0, pmChars, pmNumChars, (short) pmTLStream);
+} // MIOStream_Write
+
+
+/***************************************/
+/* External procedures for MIO library */
+/***************************************/
+
+
+/*********************/
+/* Static procedures */
+/*********************/
+/************************************************************************/
+/* MyCheckCount								*/
+/*									*/
+/* The count comes from the program, so it must not let a read run off	*/
+/* the end of the array it fills.					*/
+/************************************************************************/
+static void	MyCheckCount (OOTint pmCount, OOTint pmSize)
+{
+    if ((pmCount < 0) || (pmCount > pmSize))
+    {
+	ABORT_WITH_ERRMSG (E_STREAM_BAD_READ_COUNT,
+			   "Number of values to read (%d) is out of "
+			   "range 0 .. %d", pmCount, pmSize);
+    }
+} // MyCheckCount
+
+
+/************************************************************************/
+/* MyGetNumbers								*/
+/*									*/
+/* The line is read a chunk at a time.  A token cut off by the end of	*/
+/* a chunk is moved to the front of the buffer and completed by the	*/
+/* next one, so the line can be as long as it likes.			*/
+/************************************************************************/
+static OOTint	MyGetNumbers (OOTint pmTLStream, void *pmValues,
+			      OOTint pmMaxValues, BOOL pmReal)
+{
+    char	myBuffer [STRING_SIZE + LINE_CHUNK];
+    int		myCarry, myRead, myLength, myPos, myStart;
+    OOTint	myCount;
+    BOOL	myLineDone;
+
+    TL_TLI_TLISS (pmTLStream, 1);
+    myRead = TL_TLI_TLIGL (myBuffer, LINE_CHUNK, (short) pmTLStream);
+    if (myRead < 0)
+    {
+	return -1;
+    }
+
+    myCarry = 0;
+    myCount = 0;
+    for (;;)
+    {
+	// A short chunk ended at the newline or at end of file
+	myLineDone = (myRead < LINE_CHUNK);
+	myLength = myCarry + myRead;
+	myCarry = 0;
+	myPos = 0;
+	for (;;)
+	{
+	    while ((myPos < myLength) && IS_BLANK (myBuffer [myPos]))
+	    {
+		myPos++;
+	    }
+	    if (myPos >= myLength)
+	    {
+		break;
+	    }
+	    myStart = myPos;
+	    while ((myPos < myLength) && !IS_BLANK (myBuffer [myPos]))
+	    {
+		myPos++;
+	    }
+	    if ((myPos >= myLength) && !myLineDone)
+	    {
+		// The token may go on in the next chunk
+		myCarry = myPos - myStart;
+		if (myCarry >= STRING_SIZE)
+		{
+		    // Too long to be a number
+		    MyConvert (myBuffer + myStart, myCarry, pmValues, 0,
+			       pmReal);
+		}
+		memmove (myBuffer, myBuffer + myStart, myCarry);
+		break;
+	    }
+	    if (myCount < pmMaxValues)
+	    {
+		MyConvert (myBuffer + myStart, myPos - myStart, pmValues,
+			   myCount, pmReal);
+	    }
+	    myCount++;
+	}
+	if (myLineDone)
+	{
+	    break;
+	}
+	myRead = TL_TLI_TLIGL (myBuffer + myCarry, LINE_CHUNK,
+			       (short) pmTLStream);
+	if (myRead < 0)
+	{
+	    myRead = 0;
+	}
+    }
+
+    return myCount;
+} // MyGetNumbers
+
+
+/************************************************************************/
+/* MyConvert								*/
+/*									*/
+/* Convert a token with the same routines get uses, so exactly the same	*/
+/* input is accepted.  A token too long for a string is never a number.	*/
+/************************************************************************/
+static void	MyConvert (char *pmToken, int pmLength, void *pmValues,
+			   OOTint pmIndex, BOOL pmReal)
+{
+    char	myToken [STRING_SIZE];
+    char	myError;
+
+    if (pmLength >= STRING_SIZE)
+    {
+	pmLength = STRING_SIZE - 1;
+	myError = 1;
+    }
+    else
+    {
+	myError = 0;
+    }
+    memcpy (myToken, pmToken, pmLength);
+    myToken [pmLength] = 0;
+
+    if (pmReal)
+    {
+	if (!myError)
+	{
+	    TL_TLA_TLAVS8 (myToken, &((OOTreal *) pmValues) [pmIndex],
+			   &myError, 0);
+	}
+	if (myError)
+	{
+	    ABORT_WITH_ERRMSG (E_STREAM_BAD_REAL,
+			       "Invalid real number input \"%s\"", myToken);
+	}
+    }
+    else
+    {
+	if (!myError)
+	{
+	    TL_TLA_TLAVSI (myToken, 10, &((OOTint *) pmValues) [pmIndex],
+			   &myError, 0);
+	}
+	if (myError)
+	{
+	    ABORT_WITH_ERRMSG (E_STREAM_BAD_INTEGER,
+			       "Invalid integer input \"%s\"", myToken);
+	}
+    }
+} // MyConvert
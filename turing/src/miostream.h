@@ -0,0 +1,51 @@
+/***************/
+/* miostream.h */
+/***************/
+
+#ifndef _MIOSTREAM_H_
+#define _MIOSTREAM_H_
+
+/*******************/
+/* System includes */
+/*******************/
+
+/******************/
+/* Other includes */
+/******************/
+#include "miotypes.h"
+
+/**********/
+/* Macros */
+/**********/
+
+/*************/
+/* Constants */
+/*************/
+
+/*********/
+/* Types */
+/*********/
+
+/**********************/
+/* External variables */
+/**********************/
+
+/*********************************************/
+/* External procedures for Turing predefines */
+/*********************************************/
+extern OOTint	MIOStream_ReadAll (OOTint pmTLStream, char *pmChars,
+				   OOTint pmSize);
+extern OOTint	MIOStream_ReadLines (OOTint pmTLStream, char *pmLines,
+				     OOTint pmSize, OOTint pmMaxLines);
+extern OOTint	MIOStream_GetInts (OOTint pmTLStream, OOTint *pmValues,
+				   OOTint pmSize, OOTint pmMaxValues);
+extern OOTint	MIOStream_GetReals (OOTint pmTLStream, OOTreal *pmValues,
+				    OOTint pmSize, OOTint pmMaxValues);
+extern void	MIOStream_Write (OOTint pmTLStream, char *pmChars,
+				 OOTint pmSize, OOTint pmNumChars);
+
+/***************************************/
+/* External procedures for MIO library */
+/***************************************/
+
+#endif // #ifndef _MIOSTREAM_H_
@@ -63,6 +63,9 @@
 #include "mioview.h"
 #include "miowindow.h"
 #include "miohashmap.h"
+#include "miolongstr.h"
+#include "miointmap.h"
+#include "miostream.h"
 
 /**********/
 /* Macros */
@@ -102,6 +105,8 @@
 extern void	Language_Execute_EventQueueInsert (int pmStream, 
 					struct EventDescriptor *pmEvent);
 
+extern TLVMSTATE TLint2	Language_Execute_fileMap[];
+
 /********************/
 /* Static constants */
 /********************/
@@ -118,6 +123,7 @@ extern void	Language_Execute_EventQueueInsert (int pmStream,
 /* Static procedures */
 /*********************/
 static void	MyExecutorScan (OOTaddr *sp, const char *param, ...);
+static OOTint	MyTLStream (OOTint pmStream);
 
 
 /***********************/
@@ -893,6 +899,259 @@ void MIO_hashmap_remove (OOTaddr *sp)
     MyExecutorScan (sp, "IR", &hashId,&key);
     MIOHashmap_Remove (hashId,key);
 }
+
+void MIO_hashmap_reserve (OOTaddr *sp)
+{
+    OOTint hashId;
+	OOTint count;
+
+    MyExecutorScan (sp, "II", &hashId,&count);
+    MIOHashmap_Reserve (hashId,count);
+}
+
+void MIO_hashmap_size (OOTaddr *sp)
+{
+    OOTint hashId;
+
+    MyExecutorScan (sp, "rI", &hashId);
+	RESULT_OOT_INT(sp, MIOHashmap_Size (hashId));
+}
+
+void MIO_hashmap_clear (OOTaddr *sp)
+{
+    OOTint hashId;
+
+    MyExecutorScan (sp, "I", &hashId);
+    MIOHashmap_Clear (hashId);
+}
+
+void MIO_hashmap_first (OOTaddr *sp)
+{
+    OOTint hashId;
+	OOTstring key;
+	OOTint *value;
+
+    MyExecutorScan (sp, "rIRR", &hashId,&key,&value);
+	RESULT_OOT_BOOL(sp, MIOHashmap_First (hashId,key,value));
+}
+
+void MIO_hashmap_next (OOTaddr *sp)
+{
+    OOTint hashId;
+	OOTstring key;
+	OOTint *value;
+
+    MyExecutorScan (sp, "rIRR", &hashId,&key,&value);
+	RESULT_OOT_BOOL(sp, MIOHashmap_Next (hashId,key,value));
+}
+
+/************************************************************************/
+/* Long strings								*/
+/************************************************************************/
+
+void MIO_longstr_new (OOTaddr *sp)
+{
+    SRCPOS	srcPos;
+    Language_Execute_RunSrcPosition (&srcPos);
+
+    RESULT_OOT_INT(sp, MIOLongStr_New (&srcPos));
+} // MIO_longstr_new
+
+void MIO_longstr_free (OOTaddr *sp)
+{
+    OOTint	longStrId;
+
+    MyExecutorScan (sp, "I", &longStrId);
+    MIOLongStr_Free (longStrId);
+} // MIO_longstr_free
+
+void MIO_longstr_length (OOTaddr *sp)
+{
+    OOTint	longStrId;
+
+    MyExecutorScan (sp, "rI", &longStrId);
+    RESULT_OOT_INT(sp, MIOLongStr_Length (longStrId));
+} // MIO_longstr_length
+
+void MIO_longstr_clear (OOTaddr *sp)
+{
+    OOTint	longStrId;
+
+    MyExecutorScan (sp, "I", &longStrId);
+    MIOLongStr_Clear (longStrId);
+} // MIO_longstr_clear
+
+void MIO_longstr_assign (OOTaddr *sp)
+{
+    OOTint	longStrId;
+    OOTstring	str;
+
+    MyExecutorScan (sp, "IR", &longStrId, &str);
+    MIOLongStr_Assign (longStrId, str);
+} // MIO_longstr_assign
+
+void MIO_longstr_append (OOTaddr *sp)
+{
+    OOTint	longStrId;
+    OOTstring	str;
+
+    MyExecutorScan (sp, "IR", &longStrId, &str);
+    MIOLongStr_Append (longStrId, str);
+} // MIO_longstr_append
+
+void MIO_longstr_appendlong (OOTaddr *sp)
+{
+    OOTint	longStrId, otherId;
+
+    MyExecutorScan (sp, "II", &longStrId, &otherId);
+    MIOLongStr_AppendLong (longStrId, otherId);
+} // MIO_longstr_appendlong
+
+void MIO_longstr_sub (OOTaddr *sp)
+{
+    OOTstring	resultStr;
+    OOTint	longStrId, first, last;
+
+    MyExecutorScan (sp, "RIII", &resultStr, &longStrId, &first, &last);
+    MIOLongStr_Sub (longStrId, first, last, resultStr);
+} // MIO_longstr_sub
+
+void MIO_longstr_sublong (OOTaddr *sp)
+{
+    OOTint	longStrId, first, last;
+    SRCPOS	srcPos;
+
+    MyExecutorScan (sp, "rIII", &longStrId, &first, &last);
+    Language_Execute_RunSrcPosition (&srcPos);
+    RESULT_OOT_INT(sp, MIOLongStr_SubLong (longStrId, first, last, &srcPos));
+} // MIO_longstr_sublong
+
+void MIO_longstr_index (OOTaddr *sp)
+{
+    OOTint	longStrId, start;
+    OOTstring	pattern;
+
+    MyExecutorScan (sp, "rIRI", &longStrId, &pattern, &start);
+    RESULT_OOT_INT(sp, MIOLongStr_Index (longStrId, pattern, start));
+} // MIO_longstr_index
+
+void MIO_longstr_compare (OOTaddr *sp)
+{
+    OOTint	longStrId, otherId;
+
+    MyExecutorScan (sp, "rII", &longStrId, &otherId);
+    RESULT_OOT_INT(sp, MIOLongStr_Compare (longStrId, otherId));
+} // MIO_longstr_compare
+
+void MIO_longstr_getline (OOTaddr *sp)
+{
+    OOTint	longStrId, stream;
+
+    MyExecutorScan (sp, "rII", &longStrId, &stream);
+    RESULT_OOT_BOOL(sp, MIOLongStr_GetLine (longStrId,
+					    MyTLStream (stream)));
+} // MIO_longstr_getline
+
+void MIO_longstr_put (OOTaddr *sp)
+{
+    OOTint	longStrId, stream;
+
+    MyExecutorScan (sp, "II", &longStrId, &stream);
+    MIOLongStr_Put (longStrId, MyTLStream (stream));
+} // MIO_longstr_put
+
+/************************************************************************/
+/* Int maps and int sets						*/
+/************************************************************************/
+
+void MIO_intmap_new (OOTaddr *sp)
+{
+    SRCPOS	srcPos;
+    Language_Execute_RunSrcPosition (&srcPos);
+
+    RESULT_OOT_INT(sp, MIOIntMap_New (&srcPos, "Int map"));
+} // MIO_intmap_new
+
+void MIO_intmap_free (OOTaddr *sp)
+{
+    OOTint	mapId;
+
+    MyExecutorScan (sp, "I", &mapId);
+    MIOIntMap_Free (mapId);
+} // MIO_intmap_free
+
+void MIO_intmap_put (OOTaddr *sp)
+{
+    OOTint	mapId, key, value;
+
+    MyExecutorScan (sp, "III", &mapId, &key, &value);
+    MIOIntMap_Put (mapId, key, value);
+} // MIO_intmap_put
+
+void MIO_intmap_get (OOTaddr *sp)
+{
+    OOTint	mapId, key;
+    OOTint	*result;
+
+    MyExecutorScan (sp, "rIIR", &mapId, &key, &result);
+    RESULT_OOT_BOOL(sp, MIOIntMap_Get (mapId, key, result));
+} // MIO_intmap_get
+
+void MIO_intmap_remove (OOTaddr *sp)
+{
+    OOTint	mapId, key;
+
+    MyExecutorScan (sp, "II", &mapId, &key);
+    MIOIntMap_Remove (mapId, key);
+} // MIO_intmap_remove
+
+void MIO_intmap_contains (OOTaddr *sp)
+{
+    OOTint	mapId, key;
+
+    MyExecutorScan (sp, "rII", &mapId, &key);
+    RESULT_OOT_BOOL(sp, MIOIntMap_Contains (mapId, key));
+} // MIO_intmap_contains
+
+void MIO_intmap_size (OOTaddr *sp)
+{
+    OOTint	mapId;
+
+    MyExecutorScan (sp, "rI", &mapId);
+    RESULT_OOT_INT(sp, MIOIntMap_Size (mapId));
+} // MIO_intmap_size
+
+void MIO_intmap_clear (OOTaddr *sp)
+{
+    OOTint	mapId;
+
+    MyExecutorScan (sp, "I", &mapId);
+    MIOIntMap_Clear (mapId);
+} // MIO_intmap_clear
+
+void MIO_intmap_reserve (OOTaddr *sp)
+{
+    OOTint	mapId, count;
+
+    MyExecutorScan (sp, "II", &mapId, &count);
+    MIOIntMap_Reserve (mapId, count);
+} // MIO_intmap_reserve
+
+void MIO_intset_new (OOTaddr *sp)
+{
+    SRCPOS	srcPos;
+    Language_Execute_RunSrcPosition (&srcPos);
+
+    RESULT_OOT_INT(sp, MIOIntMap_New (&srcPos, "Int set"));
+} // MIO_intset_new
+
+void MIO_intset_add (OOTaddr *sp)
+{
+    OOTint	setId, key;
+
+    MyExecutorScan (sp, "II", &setId, &key);
+    MIOIntMap_Put (setId, key, 1);
+} // MIO_intset_add
 /************************************************************************/
 /* GUI module								*/
 /************************************************************************/
@@ -2330,6 +2589,64 @@ void MIO_text_whatchar (OOTaddr *sp)
 } // MIO_text_whatchar
 
 
+/************************************************************************/
+/* Stream module							*/
+/************************************************************************/
+void MIO_stream_readall (OOTaddr *sp)
+{
+    OOTint	stream;
+    char	*chars;
+    OOTint	charsSize;
+
+    MyExecutorScan (sp, "rIRI", &stream, &chars, &charsSize);
+    RESULT_OOT_INT(sp, MIOStream_ReadAll (MyTLStream (stream), chars,
+					  charsSize));
+} // MIO_stream_readall
+
+void MIO_stream_readlines (OOTaddr *sp)
+{
+    OOTint	stream, maxLines;
+    char	*lines;
+    struct Language_ArrayDescriptor	*descriptor;
+
+    MyExecutorScan (sp, "rIRRI", &stream, &lines, &descriptor, &maxLines);
+    RESULT_OOT_INT(sp, MIOStream_ReadLines (MyTLStream (stream), lines,
+			   descriptor -> elementCount, maxLines));
+} // MIO_stream_readlines
+
+void MIO_stream_getints (OOTaddr *sp)
+{
+    OOTint	stream, maxValues;
+    OOTint	*values;
+    struct Language_ArrayDescriptor	*descriptor;
+
+    MyExecutorScan (sp, "rIRRI", &stream, &values, &descriptor, &maxValues);
+    RESULT_OOT_INT(sp, MIOStream_GetInts (MyTLStream (stream), values,
+			   descriptor -> elementCount, maxValues));
+} // MIO_stream_getints
+
+void MIO_stream_getreals (OOTaddr *sp)
+{
+    OOTint	stream, maxValues;
+    OOTreal	*values;
+    struct Language_ArrayDescriptor	*descriptor;
+
+    MyExecutorScan (sp, "rIRRI", &stream, &values, &descriptor, &maxValues);
+    RESULT_OOT_INT(sp, MIOStream_GetReals (MyTLStream (stream), values,
+			   descriptor -> elementCount, maxValues));
+} // MIO_stream_getreals
+
+void MIO_stream_write (OOTaddr *sp)
+{
+    OOTint	stream;
+    char	*chars;
+    OOTint	charsSize, numChars;
+
+    MyExecutorScan (sp, "IRII", &stream, &chars, &charsSize, &numChars);
+    MIOStream_Write (MyTLStream (stream), chars, charsSize, numChars);
+} // MIO_stream_write
+
+
 /************************************************************************/
 /* Time module								*/
 /************************************************************************/
@@ -2836,3 +3153,25 @@ static void	MyExecutorScan (OOTaddr *sp, const char *param, ...)
     } // while
     va_end(curr_arg);
 } // MyExecutorScan
+
+
+/************************************************************************/
+/* MyTLStream								*/
+/*									*/
+/* Map a Turing stream number onto the tlib stream behind it, the same	*/
+/* way get and put do.							*/
+/************************************************************************/
+static OOTint	MyTLStream (OOTint pmStream)
+{
+    OOTint	myTLStream;
+
+    if ((pmStream < -2) || (pmStream > MaxStream) ||
+	(Language_Execute_fileMap [pmStream + 2] == -3))
+    {
+	ABORT_WITH_ERRMSG (E_STREAM_CLOSED,
+			   "I/O attempted on closed stream %d", pmStream);
+    }
+    myTLStream = Language_Execute_fileMap [pmStream + 2];
+
+    return myTLStream;
+} // MyTLStream
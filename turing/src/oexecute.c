@@ -344,7 +344,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x1906[22];
-typedef	Language___x1906	Language___x1905[255];
+typedef	Language___x1906	Language___x1905[256];
 extern Language___x1905	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -465,9 +465,9 @@ void Language_Execute_SetStep ();
 void Language_Execute_DumpThreadList ();
 
 void Language_Execute_UnitInitState ();
-TLint2	Language_Execute_executionTimeout;
-TLint4	Language_Execute_stackAllocated;
-TLboolean	Language_Execute_allWaitingForKeyboard;
+TLVMSTATE TLint2	Language_Execute_executionTimeout;
+TLVMSTATE TLint4	Language_Execute_stackAllocated;
+TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -475,8 +475,8 @@ extern void TL_TLB_TLBUNI ();
 
 ////extern void strcpy ();
 typedef	TLint2	Language_Execute_ExecutionError_OverflowKind;
-static TLint4	Language_Execute_ExecutionError_savedQuitCode;
-static TLstring	Language_Execute_ExecutionError_savedMessage;
+static TLVMSTATE TLint4	Language_Execute_ExecutionError_savedQuitCode;
+static TLVMSTATE TLstring	Language_Execute_ExecutionError_savedMessage;
 
 void Language_Execute_ExecutionError_Abort (quitCode, message)
 TLint4	quitCode;
@@ -492,7 +492,7 @@ TLstring	message;
     TL_TLE_TLEQUIT ((TLint4) 2, (char *) 0, 0);
     TLRESTORELF();
 }
-static Language_Execute_ExecutionError_OverflowKind	Language_Execute_ExecutionError_overflowKind;
+static TLVMSTATE Language_Execute_ExecutionError_OverflowKind	Language_Execute_ExecutionError_overflowKind;
 
 void Language_Execute_ExecutionError_SetOverflowKind (kind)
 Language_Execute_ExecutionError_OverflowKind	kind;
@@ -775,14 +775,14 @@ extern TLboolean MIO_PlayDone ();
 extern void MIO_RegisterOpen ();
 
 extern void MIO_RegisterClose ();
-TLnat2	Language_Execute_numArguments;
+TLVMSTATE TLnat2	Language_Execute_numArguments;
 typedef	TLint1	Language_Execute___x1924[23];
-Language_Execute___x1924	Language_Execute_fileMap;
+TLVMSTATE Language_Execute___x1924	Language_Execute_fileMap;
 typedef	Language_StringDef	*Language_Execute___x1927[21];
-Language_Execute___x1927	Language_Execute_argumentNames;
-static TLnat2	Language_Execute_numFilesOpen;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+TLVMSTATE Language_Execute___x1927	Language_Execute_argumentNames;
+static TLVMSTATE TLnat2	Language_Execute_numFilesOpen;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 
 extern void TL_TLI_TLIOF ();
 
@@ -1145,17 +1145,17 @@ struct	Language_Execute_ConditionDefinition {
     TLaddressint	name;
     struct Language_Execute_ConditionDefinition	*nextVariable;
 };
-struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
-struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
-TLnat4	Language_Execute_Chrono;
-TLint4	Language_Execute_processCount;
-TLaddressint	Language_Execute_globalPC;
-TLaddressint	Language_Execute_globalSP;
+TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
+TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
+TLVMSTATE TLnat4	Language_Execute_Chrono;
+TLVMSTATE TLint4	Language_Execute_processCount;
+TLVMSTATE TLaddressint	Language_Execute_globalPC;
+TLVMSTATE TLaddressint	Language_Execute_globalSP;
 typedef	Language_Opcode	Language_Execute___x1943[1];
 Language_Execute___x1943	Language_Execute_nullRoutine = 
     {206};
-TLaddressint	Language_Execute_savedInitPC;
-TLaddressint	Language_Execute_savedInitFP;
+TLVMSTATE TLaddressint	Language_Execute_savedInitPC;
+TLVMSTATE TLaddressint	Language_Execute_savedInitFP;
 
 void Language_Execute_UnitInitState (pc, fp)
 TLaddressint	*pc;
@@ -2853,7 +2853,7 @@ Language_Opcode	op;
 	default :
 	    {
 		TLSETL(101277);
-		if (op > 254) {
+		if (op > 255) {
 		    TLSETL(101280);
 		    {
 			TLstring	__x2198;
@@ -2868,7 +2868,7 @@ Language_Opcode	op;
 		    TLSETL(101288);
 		    {
 			TLstring	__x2199;
-			TL_TLS_TLSCAT("Unimplemented opcode ", Language_OpcodeName[TLINRANGELOW(op, 0, 254, 1)], __x2199);
+			TL_TLS_TLSCAT("Unimplemented opcode ", Language_OpcodeName[TLINRANGELOW(op, 0, 255, 1)], __x2199);
 			Language_Execute_ExecutionError_Abort((TLint4) 10000, __x2199);
 		    };
 		};
@@ -2900,7 +2900,7 @@ void Language_Execute_RecoverAllMemory () {
     Language_Execute_EQHead = (struct Language_Execute_ProcessDescriptor *) 0;
     TLRESTORELF();
 }
-TLint4	Language_Execute_quantaCount;
+TLVMSTATE TLint4	Language_Execute_quantaCount;
 
 void Language_Execute_Initialize (startPC, maxStackSize, inName, outName, args, numArgs)
 TLaddressint	startPC;
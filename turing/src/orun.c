@@ -303,7 +303,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2287[22];
-typedef	Language___x2287	Language___x2286[255];
+typedef	Language___x2287	Language___x2286[256];
 extern Language___x2286	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -424,9 +424,9 @@ extern void Language_Execute_SetStep ();
 extern void Language_Execute_DumpThreadList ();
 
 extern void Language_Execute_UnitInitState ();
-extern TLint2	Language_Execute_executionTimeout;
-extern TLint4	Language_Execute_stackAllocated;
-extern TLboolean	Language_Execute_allWaitingForKeyboard;
+extern TLVMSTATE TLint2	Language_Execute_executionTimeout;
+extern TLVMSTATE TLint4	Language_Execute_stackAllocated;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -659,13 +659,13 @@ extern TLboolean MIO_PlayDone ();
 extern void MIO_RegisterOpen ();
 
 extern void MIO_RegisterClose ();
-extern TLnat2	Language_Execute_numArguments;
+extern TLVMSTATE TLnat2	Language_Execute_numArguments;
 typedef	TLint1	Language_Execute___x2305[23];
-extern Language_Execute___x2305	Language_Execute_fileMap;
+extern TLVMSTATE Language_Execute___x2305	Language_Execute_fileMap;
 typedef	Language_StringDef	*Language_Execute___x2308[21];
-extern Language_Execute___x2308	Language_Execute_argumentNames;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+extern TLVMSTATE Language_Execute___x2308	Language_Execute_argumentNames;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 
 void Language_Execute_AddFile ();
 
@@ -739,16 +739,16 @@ struct	Language_Execute_ConditionDefinition {
     TLaddressint	name;
     struct Language_Execute_ConditionDefinition	*nextVariable;
 };
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
-extern TLnat4	Language_Execute_Chrono;
-extern TLint4	Language_Execute_processCount;
-extern TLaddressint	Language_Execute_globalPC;
-extern TLaddressint	Language_Execute_globalSP;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
+extern TLVMSTATE TLnat4	Language_Execute_Chrono;
+extern TLVMSTATE TLint4	Language_Execute_processCount;
+extern TLVMSTATE TLaddressint	Language_Execute_globalPC;
+extern TLVMSTATE TLaddressint	Language_Execute_globalSP;
 typedef	Language_Opcode	Language_Execute___x2324[1];
 extern Language_Execute___x2324	Language_Execute_nullRoutine;
-extern TLaddressint	Language_Execute_savedInitPC;
-extern TLaddressint	Language_Execute_savedInitFP;
+extern TLVMSTATE TLaddressint	Language_Execute_savedInitPC;
+extern TLVMSTATE TLaddressint	Language_Execute_savedInitFP;
 
 void Language_Execute_DumpStack ();
 
@@ -821,7 +821,7 @@ void Language_Execute_DispatchHandler ();
 extern void TLEABT ();
 
 void Language_Execute_ExtraRoutines ();
-extern TLint4	Language_Execute_quantaCount;
+extern TLVMSTATE TLint4	Language_Execute_quantaCount;
 
 extern void Math_Arctan ();
 
@@ -978,7 +978,7 @@ struct Language_Execute_RunDescriptor	*runDesc;
 		TL_TLI_TLIPS ((TLint4) 0, " PC=", (TLint2) 0);
 		TL_TLI_TLIPI ((TLint4) 0, (TLint4) ((unsigned long) Language_Execute_globalPC - Language_codeOprSize), (TLint2) 0);
 		TL_TLI_TLIPS ((TLint4) 0, " OPCODE=", (TLint2) 0);
-		TL_TLI_TLIPS ((TLint4) 0, (Language_OpcodeName[TLINRANGELOW(op, 0, 254, 1)]), (TLint2) 0);
+		TL_TLI_TLIPS ((TLint4) 0, (Language_OpcodeName[TLINRANGELOW(op, 0, 255, 1)]), (TLint2) 0);
 		TL_TLI_TLIPS ((TLint4) 0, " FP=", (TLint2) 0);
 		TL_TLI_TLIPN ((TLint4) 0, (TLnat4) fp, (TLint2) 0);
 		TL_TLI_TLIPS ((TLint4) 0, " SP=", (TLint2) 0);
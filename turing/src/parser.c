@@ -353,7 +353,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2912[22];
-typedef	Language___x2912	Language___x2911[255];
+typedef	Language___x2912	Language___x2911[256];
 extern Language___x2911	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
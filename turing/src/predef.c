@@ -338,7 +338,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2633[22];
-typedef	Language___x2633	Language___x2632[255];
+typedef	Language___x2633	Language___x2632[256];
 extern Language___x2632	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -332,7 +332,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2037[22];
-typedef	Language___x2037	Language___x2036[255];
+typedef	Language___x2037	Language___x2036[256];
 extern Language___x2036	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
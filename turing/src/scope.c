@@ -333,7 +333,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2085[22];
-typedef	Language___x2085	Language___x2084[255];
+typedef	Language___x2085	Language___x2084[256];
 extern Language___x2084	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
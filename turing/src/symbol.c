@@ -336,7 +336,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2476[22];
-typedef	Language___x2476	Language___x2475[255];
+typedef	Language___x2476	Language___x2475[256];
 extern Language___x2475	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -303,7 +303,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x1857[22];
-typedef	Language___x1857	Language___x1856[255];
+typedef	Language___x1857	Language___x1856[256];
 extern Language___x1856	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -424,9 +424,9 @@ extern void Language_Execute_SetStep ();
 extern void Language_Execute_DumpThreadList ();
 
 extern void Language_Execute_UnitInitState ();
-extern TLint2	Language_Execute_executionTimeout;
-extern TLint4	Language_Execute_stackAllocated;
-extern TLboolean	Language_Execute_allWaitingForKeyboard;
+extern TLVMSTATE TLint2	Language_Execute_executionTimeout;
+extern TLVMSTATE TLint4	Language_Execute_stackAllocated;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -656,13 +656,13 @@ extern void MIO_PlaySound ();
 extern void MIO_Play ();
 
 extern TLboolean MIO_PlayDone ();
-extern TLnat2	Language_Execute_numArguments;
-typedef	TLint1	Language_Execute___x1875[23];
-extern Language_Execute___x1875	Language_Execute_fileMap;
+extern TLVMSTATE TLnat2	Language_Execute_numArguments;
+typedef	TLint2	Language_Execute___x1875[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE Language_Execute___x1875	Language_Execute_fileMap;
 typedef	Language_StringDef	*Language_Execute___x1878[21];
-extern Language_Execute___x1878	Language_Execute_argumentNames;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+extern TLVMSTATE Language_Execute___x1878	Language_Execute_argumentNames;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 
 void Language_Execute_AddFile ();
 
@@ -708,7 +708,9 @@ struct	Language_Execute_ProcessDescriptor {
     TLnat4	waitParameter;
     struct Language_Execute_ConditionDescriptor	*waitCondition;
     struct Language_Execute_ProcessDescriptor	*nextTimeout;
+    struct Language_Execute_ProcessDescriptor	*prevTimeout;
     TLnat4	totalPause;
+    TLnat4	switches;
     struct Language_Execute_HandlerArea	*activeHandler;
     struct Language_Execute_HandlerArea	*runningHandler;
     Language_Step	stepSpec;
@@ -736,16 +738,16 @@ struct	Language_Execute_ConditionDefinition {
     TLaddressint	name;
     struct Language_Execute_ConditionDefinition	*nextVariable;
 };
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
-extern TLnat4	Language_Execute_Chrono;
-extern TLint4	Language_Execute_processCount;
-extern TLaddressint	Language_Execute_globalPC;
-extern TLaddressint	Language_Execute_globalSP;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
+extern TLVMSTATE TLnat4	Language_Execute_Chrono;
+extern TLVMSTATE TLint4	Language_Execute_processCount;
+extern TLVMSTATE TLaddressint	Language_Execute_globalPC;
+extern TLVMSTATE TLaddressint	Language_Execute_globalSP;
 typedef	Language_Opcode	Language_Execute___x1894[1];
 extern Language_Execute___x1894	Language_Execute_nullRoutine;
-extern TLaddressint	Language_Execute_savedInitPC;
-extern TLaddressint	Language_Execute_savedInitFP;
+extern TLVMSTATE TLaddressint	Language_Execute_savedInitPC;
+extern TLVMSTATE TLaddressint	Language_Execute_savedInitFP;
 
 void Language_Execute_DumpStack ();
 
@@ -773,6 +775,8 @@ extern void Language_Execute_Kernel_RunQueueInsert ();
 
 extern void Language_Execute_Kernel_SetProcessPriority ();
 
+extern void Language_Execute_Kernel_SetSlice ();
+
 extern void Language_Execute_Kernel_SignalDeferredCondition ();
 
 extern void Language_Execute_Kernel_SignalPriorityCondition ();
@@ -818,7 +822,9 @@ void Language_Execute_DispatchHandler ();
 extern void TLEABT ();
 
 void Language_Execute_ExtraRoutines ();
-extern TLint4	Language_Execute_quantaCount;
+extern TLVMSTATE TLint4	Language_Execute_quantaCount;
+extern TLVMSTATE TLint4	Language_Execute_quantum;
+extern TLVMSTATE TLnat4	Language_Execute_switchCount;
 
 extern void Math_Arctan ();
 
@@ -890,14 +896,20 @@ void Language_Execute_System_Nargs ();
 
 void Language_Execute_System_Setactive ();
 
+void Language_Execute_System_Setslice ();
+
 void Language_Execute_System_Simutime ();
 
+void Language_Execute_System_Switches ();
+
 void Language_Execute_System_Sysclock ();
 
 void Language_Execute_System_System ();
 
 void Language_Execute_System_Time ();
 
+void Language_Execute_System_Totalswitches ();
+
 void Language_Execute_System_Wallclock ();
 extern TLint4	TL_TLI_TLIARC;
 
@@ -1023,6 +1035,27 @@ TLaddressint	sp;
     };
 }
 
+void Language_Execute_System_Setslice (sp)
+TLaddressint	sp;
+{
+    TLSTACKCHECK();
+    Language_Execute_Kernel_SetSlice((* (TLint4 *) sp), (* (TLint4 *) ((unsigned long) sp + 4)));
+}
+
+void Language_Execute_System_Switches (sp)
+TLaddressint	sp;
+{
+    TLSTACKCHECK();
+    (* (TLint4 *) ((* (TLaddressint *) sp))) = Language_Execute_RQHead->switches;
+}
+
+void Language_Execute_System_Totalswitches (sp)
+TLaddressint	sp;
+{
+    TLSTACKCHECK();
+    (* (TLint4 *) ((* (TLaddressint *) sp))) = Language_Execute_switchCount;
+}
+
 void Language_Execute_System_Simutime (sp)
 TLaddressint	sp;
 {
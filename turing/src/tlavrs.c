@@ -27,8 +27,19 @@
 #include <stdio.h>
 #endif
 
+#include <float.h>
+
 extern double modf();
 
+/*
+** With exact double arithmetic (no x87 excess precision) the
+** fraction digits can be peeled off without calling modf: for
+** 0 <= x < 10, x - (int)x is exact, so the digits are the same.
+*/
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+#define	TLAVRS_EXACT
+#endif
+
 
 #define	StringLength	255
 #define	BufferSize	500
@@ -57,6 +68,7 @@ char *err;
 {
     register int exponent;
     double intPart;
+    unsigned long whole;
     register char *dst, *ptr;
 
 #ifdef DEBUG
@@ -87,9 +99,17 @@ char *err;
 
     /*
     ** Set "arg" to be the fractional part of the value
-    ** and "intPart" to be the integral part.
+    ** and "intPart" to be the integral part.  Below 2^32 the
+    ** integral part also fits in "whole", and subtracting it
+    ** leaves exactly the fraction modf would.
     */
-    arg = modf(arg, &intPart);
+    if (arg < 4294967296.0) {
+	whole = (unsigned long) arg;
+	intPart = (double) whole;
+	arg -= intPart;
+    } else {
+	arg = modf(arg, &intPart);
+    }
 
     /*
     ** Convert the integer part to string format.
@@ -103,16 +123,25 @@ char *err;
 	double digit;
 
 	/*
-	** Generate digits and store in backwards order.
+	** Generate digits and store in backwards order.  Below 2^32 the
+	** quotients are close enough that these are exactly the decimal
+	** digits, so take them with integer arithmetic.
 	*/
-	for (ptr = &buffer[BufferSize]; intPart != 0; exponent++) {
-            digit = modf(intPart/10, &intPart);
-	    *--ptr = (int)((digit+.03)*10.0) + '0';
+	if (intPart < 4294967296.0) {
+	    for (ptr = &buffer[BufferSize]; whole != 0; exponent++) {
+		*--ptr = (int)(whole % 10) + '0';
+		whole /= 10;
+	    }
+	} else {
+	    for (ptr = &buffer[BufferSize]; intPart != 0; exponent++) {
+		digit = modf(intPart/10, &intPart);
+		*--ptr = (int)((digit+.03)*10.0) + '0';
 #ifdef DEBUG
-	    fprintf (logfp, "TLAVRS:  Generated digit %c, rem = %lf %s\n",
-		    *ptr, intPart, hex(intPart));
+		fprintf (logfp, "TLAVRS:  Generated digit %c, rem = %lf %s\n",
+			*ptr, intPart, hex(intPart));
 #endif
-        }
+	    }
+	}
 	/*
 	** Now store the as many digits as we can into result.
 	*/
@@ -177,7 +206,13 @@ char *err;
     while (dst <= ptr) {
 	double digit;
 
+#ifdef TLAVRS_EXACT
+	arg *= 10.0;
+	digit = (double) (int) arg;
+	arg -= digit;
+#else
         arg = modf(arg * 10.0, &digit);
+#endif
         *dst++ = (int)digit + '0';
 #ifdef DEBUG
 	fprintf (logfp, "TLAVRS:  Generated fractional digit %c, rem = %lf %s\n",
@@ -98,6 +98,9 @@ static int    MyGetDirectoryFromPath (const char *pmPath,
                              char *pmDirectory);
 static void MyGetFilePathFromCmdLine(const char *cmdLine, unsigned int start, char *outFileName, char *outFilePath);
 
+extern void TL_TLI_TLIBFM ();
+extern int TL_TLI_TLIBFT ();
+
 int main(int argc, char* argv[])
 {
     int myStatus;
@@ -141,10 +144,11 @@ int main(int argc, char* argv[])
             return FALSE; // initialize failed
 
     // Initialize the MIO module
-    MIO_Initialize (gProgram.applicationInstance, OS_WINDOWS, 
+    if (!MIO_Initialize (gProgram.applicationInstance, OS_WINDOWS, 
                 stApplicationDirectory, stStartupDirectory,
                 FALSE, FALSE,
-            SYSEXIT_ERROR_STRING);
+            SYSEXIT_ERROR_STRING))
+        return FALSE; // initialize failed
                 
     // Get rid of the ".exe" at the end of a file name
     // Initialize MIO
@@ -179,15 +183,25 @@ int main(int argc, char* argv[])
     stTuringProgramHalting = FALSE;
     stQuittingEnvironment = FALSE;
     
+    // Map a redirected standard input while mmap of a file is still allowed
+    TL_TLI_TLIBFM ();
+    // Read a piped standard input ahead while threads can still be made
+    int myPrefetching = TL_TLI_TLIBFT ();
+
     // seccomp!!!
 #define add(x,...) &&!(ret=seccomp_rule_add(ctx,SCMP_ACT_ALLOW,SCMP_SYS(x),__VA_ARGS__))
 #if USE_SECCOMP
     scmp_filter_ctx ctx;
     int ret;
     if((ctx=seccomp_init(SCMP_ACT_KILL))
+       // Sandbox the input reader thread as well
+       &&!(myPrefetching&&(ret=seccomp_attr_set(ctx,SCMP_FLTATR_CTL_TSYNC,1)))
        add(read,1,SCMP_A0(SCMP_CMP_EQ,STDIN_FILENO))
        add(write,1,SCMP_A0(SCMP_CMP_EQ,STDOUT_FILENO))
        add(write,1,SCMP_A0(SCMP_CMP_EQ,STDERR_FILENO))
+       add(readv,1,SCMP_A0(SCMP_CMP_EQ,STDIN_FILENO))
+       add(writev,1,SCMP_A0(SCMP_CMP_EQ,STDOUT_FILENO))
+       add(futex,0)
        add(fstat64,1,SCMP_A0(SCMP_CMP_EQ,STDIN_FILENO))
        add(fstat64,1,SCMP_A0(SCMP_CMP_EQ,STDOUT_FILENO))
        add(fstat64,1,SCMP_A0(SCMP_CMP_EQ,STDERR_FILENO))
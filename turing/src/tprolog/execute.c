@@ -242,13 +242,13 @@ void Language_Execute_Executor ();
 void Language_Execute_EndExecution ();
 
 void Language_Execute_RecoverAllMemory ();
-TLint2	Language_Execute_executionTimeout;
+TLVMSTATE TLint2	Language_Execute_executionTimeout;
 TLboolean	Language_Execute_externalExecutionTimeoutFlag;
-TLint4	Language_Execute_stackAllocated;
-TLboolean	Language_Execute_allWaitingForKeyboard;
-TLboolean	Language_Execute_allWaitingForMouse;
-TLboolean	Language_Execute_allWaitingForDelay;
-TLint4	Language_Execute_minimumDelayCount;
+TLVMSTATE TLint4	Language_Execute_stackAllocated;
+TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
+TLVMSTATE TLboolean	Language_Execute_allWaitingForMouse;
+TLVMSTATE TLboolean	Language_Execute_allWaitingForDelay;
+TLVMSTATE TLint4	Language_Execute_minimumDelayCount;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -256,8 +256,8 @@ extern void TL_TLB_TLBUNI ();
 
 extern void strcpy ();
 typedef	TLint2	Language_Execute_ExecutionError_OverflowKind;
-static TLint4	Language_Execute_ExecutionError_savedQuitCode;
-static TLstring	Language_Execute_ExecutionError_savedMessage;
+static TLVMSTATE TLint4	Language_Execute_ExecutionError_savedQuitCode;
+static TLVMSTATE TLstring	Language_Execute_ExecutionError_savedMessage;
 
 void Language_Execute_ExecutionError_Abort (quitCode, message)
 TLint4	quitCode;
@@ -273,7 +273,7 @@ TLstring	message;
     TL_TLE_TLEQUIT ((TLint4) 2, (char *) 0, 0);
     TLRESTORELF();
 }
-static Language_Execute_ExecutionError_OverflowKind	Language_Execute_ExecutionError_overflowKind;
+static TLVMSTATE Language_Execute_ExecutionError_OverflowKind	Language_Execute_ExecutionError_overflowKind;
 
 void Language_Execute_ExecutionError_SetOverflowKind (kind)
 Language_Execute_ExecutionError_OverflowKind	kind;
@@ -421,10 +421,14 @@ void ExecutionError () {
 
 extern void Language_Execute_Heap_Alloc ();
 
+extern void Language_Execute_Heap_AllocStack ();
+
 extern void Language_Execute_Heap_CleanUp ();
 
 extern void Language_Execute_Heap_Dealloc ();
 
+extern void Language_Execute_Heap_DeallocStack ();
+
 extern void Language_Execute_Heap_Free ();
 
 extern void Language_Execute_Heap_New ();
@@ -557,14 +561,14 @@ extern TLboolean MIO_PlayDone ();
 extern void MIO_RegisterOpen ();
 
 extern void MIO_RegisterClose ();
-TLnat2	Language_Execute_numArguments;
-typedef	TLint1	Language_Execute___x1656[23];
-Language_Execute___x1656	Language_Execute_fileMap;
+TLVMSTATE TLnat2	Language_Execute_numArguments;
+typedef	TLint2	Language_Execute___x1656[TL_TLI_MAXSTREAM + 3];
+TLVMSTATE Language_Execute___x1656	Language_Execute_fileMap;
 typedef	Language_StringDef	*Language_Execute___x1659[21];
-Language_Execute___x1659	Language_Execute_argumentNames;
-static TLnat2	Language_Execute_numFilesOpen;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+TLVMSTATE Language_Execute___x1659	Language_Execute_argumentNames;
+static TLVMSTATE TLnat2	Language_Execute_numFilesOpen;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 
 extern void TL_TLI_TLIOF ();
 
@@ -614,7 +618,9 @@ struct	Language_Execute_ProcessDescriptor {
     TLnat4	waitParameter;
     struct Language_Execute_ConditionDescriptor	*waitCondition;
     struct Language_Execute_ProcessDescriptor	*nextTimeout;
+    struct Language_Execute_ProcessDescriptor	*prevTimeout;
     TLnat4	totalPause;
+    TLnat4	switches;
     struct Language_Execute_HandlerArea	*activeHandler;
     struct Language_Execute_HandlerArea	*runningHandler;
 };
@@ -640,12 +646,12 @@ struct	Language_Execute_ConditionDefinition {
     TLaddressint	name;
     struct Language_Execute_ConditionDefinition	*nextVariable;
 };
-struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
-struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
-TLnat4	Language_Execute_Chrono;
-TLint4	Language_Execute_processCount;
-TLaddressint	Language_Execute_globalPC;
-TLaddressint	Language_Execute_globalSP;
+TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
+TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
+TLVMSTATE TLnat4	Language_Execute_Chrono;
+TLVMSTATE TLint4	Language_Execute_processCount;
+TLVMSTATE TLaddressint	Language_Execute_globalPC;
+TLVMSTATE TLaddressint	Language_Execute_globalSP;
 typedef	Language_Opcode	Language_Execute___x1661[1];
 Language_Execute___x1661	Language_Execute_nullRoutine = 
     {206};
@@ -758,14 +764,14 @@ TLint4 Language_Execute_GetStackAllocated () {
     /* NOTREACHED */
     TLFCNRESULTABORT;
 }
-static TLint4	Language_Execute_failedOpenStream;
+static TLVMSTATE TLint4	Language_Execute_failedOpenStream;
 struct	Language_Execute___x1668 {
     TLint4	streamNo;
     TLstring	msg;
     struct SrcPosition	srcPos;
 };
 typedef	struct Language_Execute___x1668	Language_Execute___x1667[10];
-static Language_Execute___x1667	Language_Execute_failedOpenInfo;
+static TLVMSTATE Language_Execute___x1667	Language_Execute_failedOpenInfo;
 
 void Language_Execute_AddFile (fnum, mode)
 TLint4	*fnum;
@@ -799,7 +805,7 @@ TLint4	mode;
 	return;
     };
     TLSETL(100340);
-    if ((Language_Execute_numArguments + Language_Execute_numFilesOpen) == 20) {
+    if ((Language_Execute_numArguments + Language_Execute_numFilesOpen) == TL_TLI_MAXSTREAM) {
 	TLSETL(100341);
 	TL_TLI_TLICL ((TLint4) (*fnum));
 	TLINCL();
@@ -811,11 +817,11 @@ TLint4	mode;
     TLSETL(100346);
     {
 	register TLint4	i;
-	for (i = Language_Execute_numArguments + 1; i <= 20; i++) {
+	for (i = Language_Execute_numArguments + 1; i <= TL_TLI_MAXSTREAM; i++) {
 	    TLSETL(100347);
-	    if ((Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)]) == -3) {
+	    if ((Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)]) == -3) {
 		TLSETL(100348);
-		Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)] = (*fnum);
+		Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)] = (*fnum);
 		TLINCL();
 		(*fnum) = i;
 		TLINCL();
@@ -1055,7 +1061,7 @@ register TLint4	fnum;
 	Language_Execute_BadStreamAbortMessage((TLint4) fnum, "Close");
     } else {
 	TLSETL(100455);
-	if (fnum > 20) {
+	if (fnum > TL_TLI_MAXSTREAM) {
 	    TLSETL(100458);
 	    {
 		TLstring	__x1706;
@@ -1068,7 +1074,7 @@ register TLint4	fnum;
 	    };
 	} else {
 	    TLSETL(100458);
-	    if ((Language_Execute_fileMap[TLINRANGELOW(fnum, -2, 20, 1)]) == -3) {
+	    if ((Language_Execute_fileMap[TLINRANGELOW(fnum, -2, TL_TLI_MAXSTREAM, 1)]) == -3) {
 		TLSETL(100461);
 		{
 		    TLstring	__x1708;
@@ -1083,10 +1089,10 @@ register TLint4	fnum;
 	};
     };
     TLSETL(100463);
-    TL_TLI_TLICL ((TLint4) (Language_Execute_fileMap[TLINRANGELOW(fnum, -2, 20, 1)]));
+    TL_TLI_TLICL ((TLint4) (Language_Execute_fileMap[TLINRANGELOW(fnum, -2, TL_TLI_MAXSTREAM, 1)]));
     TLSETL(100468);
     MIO_RegisterClose((TLint4) fnum);
-    Language_Execute_fileMap[TLINRANGELOW(fnum, -2, 20, 1)] = -3;
+    Language_Execute_fileMap[TLINRANGELOW(fnum, -2, TL_TLI_MAXSTREAM, 1)] = -3;
     TLSETL(100470);
     if (fnum > Language_Execute_numArguments) {
 	TLSETL(100471);
@@ -1117,14 +1123,14 @@ static void Language_Execute_CloseAllFiles () {
     TLSETL(100486);
     {
 	register TLint4	i;
-	for (i = 1; i <= 20; i++) {
+	for (i = 1; i <= TL_TLI_MAXSTREAM; i++) {
 	    TLSETL(100487);
-	    if ((Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)]) != -3) {
+	    if ((Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)]) != -3) {
 		TLSETL(100488);
-		TL_TLI_TLICL ((TLint4) (Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)]));
+		TL_TLI_TLICL ((TLint4) (Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)]));
 		TLSETL(100493);
 		MIO_RegisterClose((TLint4) i);
-		Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)] = -3;
+		Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)] = -3;
 	    };
 	};
     };
@@ -1141,7 +1147,7 @@ TLboolean	abort;
     TLSTKCHKSLF(100501);
     TLSETF();
     TLSETL(100501);
-    TLPRE (((TL_TLI_TLIXSN > 0) && (TL_TLI_TLIXSN <= Language_Execute_numArguments)) && ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)]) == -3));
+    TLPRE (((TL_TLI_TLIXSN > 0) && (TL_TLI_TLIXSN <= Language_Execute_numArguments)) && ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)]) == -3));
     TLSETL(100505);
     if ((Language_Execute_argumentNames[TLINRANGELOW(TL_TLI_TLIXSN, 0, 20, 1)]) == ((Language_StringDef *) 0)) {
 	TLSETL(100508);
@@ -1180,7 +1186,7 @@ TLboolean	abort;
 	};
     } else {
 	TLSETL(100522);
-	Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)] = f;
+	Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)] = f;
     };
     TLRESTORELF();
 }
@@ -1196,9 +1202,9 @@ TLint4	*stream;
     TLINCL();
     if ((*stream) != 0) {
 	TLSETL(100532);
-	if ((Language_Execute_fileMap[TLINRANGELOW((*stream), -2, 20, 1)]) != -3) {
+	if ((Language_Execute_fileMap[TLINRANGELOW((*stream), -2, TL_TLI_MAXSTREAM, 1)]) != -3) {
 	    TLSETL(100533);
-	    fd = Language_Execute_fileMap[TLINRANGELOW((*stream), -2, 20, 1)];
+	    fd = Language_Execute_fileMap[TLINRANGELOW((*stream), -2, TL_TLI_MAXSTREAM, 1)];
 	} else {
 	    TLSETL(100535);
 	    (*stream) = 0;
@@ -1237,6 +1243,8 @@ extern void Language_Execute_Kernel_RunQueueInsert ();
 
 extern void Language_Execute_Kernel_SetProcessPriority ();
 
+extern void Language_Execute_Kernel_SetSlice ();
+
 extern void Language_Execute_Kernel_SignalDeferredCondition ();
 
 extern void Language_Execute_Kernel_SignalPriorityCondition ();
@@ -1263,7 +1271,7 @@ struct MIO_EventDescriptor	*event;
     TLSTKCHKSLF(100629);
     TLSETF();
     TLSETL(100629);
-    fileStream = Language_Execute_fileMap[TLINRANGELOW(stream, -2, 20, 1)];
+    fileStream = Language_Execute_fileMap[TLINRANGELOW(stream, -2, TL_TLI_MAXSTREAM, 1)];
     TLINCL();
     if (fileStream == -3) {
 	TLSETL(100632);
@@ -1504,7 +1512,7 @@ void Language_Execute_Open () {
 		    };
 		};
 		TLSETL(100760);
-		if ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)]) != -3) {
+		if ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)]) != -3) {
 		    TLSETL(100763);
 		    {
 			TLstring	__x1736;
@@ -1549,7 +1557,7 @@ void Language_Execute_Put () {
     TLINCL();
     Language_Execute_globalSP += 4;
     TLINCL();
-    stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)];
+    stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)];
     TLINCL();
     if (stream == -3) {
 	TLSETL(100783);
@@ -1800,7 +1808,7 @@ void Language_Execute_Get () {
     TLINCL();
     Language_Execute_globalSP += 4;
     TLINCL();
-    stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)];
+    stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)];
     TLINCL();
     if (stream == -3) {
 	TLSETL(100914);
@@ -2398,7 +2406,7 @@ Language_Opcode	op;
 		TLSETL(101188);
 		TL_TLI_TLIXSN = (* (TLint4 *) ((* (TLaddressint *) Language_Execute_globalSP)));
 		TLINCL();
-		stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)];
+		stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)];
 		TLINCL();
 		if (stream == -3) {
 		    TLSETL(101195);
@@ -2475,7 +2483,7 @@ Language_Opcode	op;
 		TLINCL();
 		Language_Execute_globalSP += 4;
 		TLINCL();
-		stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)];
+		stream = Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)];
 		TLINCL();
 		if (stream == -3) {
 		    TLSETL(101240);
@@ -2576,7 +2584,7 @@ Language_Opcode	op;
 		    Language_Execute_BadStreamAbortMessage((TLint4) TL_TLI_TLIXSN, "I/O");
 		} else {
 		    TLSETL(101309);
-		    if (TL_TLI_TLIXSN > 20) {
+		    if (TL_TLI_TLIXSN > TL_TLI_MAXSTREAM) {
 			TLSETL(101313);
 			{
 			    TLstring	__x1927;
@@ -2590,7 +2598,7 @@ Language_Opcode	op;
 		    };
 		};
 		TLSETL(101314);
-		if ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, 20, 1)]) == -3) {
+		if ((Language_Execute_fileMap[TLINRANGELOW(TL_TLI_TLIXSN, -2, TL_TLI_MAXSTREAM, 1)]) == -3) {
 		    Language_StreamModeSet	openMode;
 		    TLSETL(101315);
 		    if (TL_TLI_TLIXSN > Language_Execute_numArguments) {
@@ -2764,7 +2772,7 @@ Language_Opcode	op;
 	default :
 	    {
 		TLSETL(101417);
-		if (op > 254) {
+		if (op > 255) {
 		    TLSETL(101420);
 		    {
 			TLstring	__x1958;
@@ -2821,7 +2829,9 @@ void Language_Execute_RecoverAllMemory () {
     Language_Execute_EQHead = (struct Language_Execute_ProcessDescriptor *) 0;
     TLRESTORELF();
 }
-TLint4	Language_Execute_quantaCount;
+TLVMSTATE TLint4	Language_Execute_quantaCount;
+TLVMSTATE TLint4	Language_Execute_quantum;
+TLVMSTATE TLnat4	Language_Execute_switchCount;
 
 void Language_Execute_Initialize (startPC, maxStackSize, inName, outName, args, numArgs)
 TLaddressint	startPC;
@@ -2923,7 +2933,7 @@ TLint4	numArgs;
     TLSETL(101505);
     for(;;) {
 	TLSETL(101507);
-	Language_Execute_Heap_Alloc(&(stackBase), (TLnat4) ((256 + stackSize) + sizeof(struct Language_Execute_ProcessDescriptor)));
+	Language_Execute_Heap_AllocStack(&(stackBase), (TLnat4) ((256 + stackSize) + sizeof(struct Language_Execute_ProcessDescriptor)));
 	if ((unsigned long) stackBase != 0) {
 	    break;
 	};
@@ -2973,6 +2983,7 @@ TLint4	numArgs;
     Language_Execute_RQHead->dispatchPriority = 1000;
     TLINCL();
     Language_Execute_RQHead->totalPause = 0;
+    Language_Execute_RQHead->switches = 0;
     TLINCL();
     Language_Execute_RQHead->activeHandler = (struct Language_Execute_HandlerArea *) 0;
     TLINCL();
@@ -2984,6 +2995,7 @@ TLint4	numArgs;
     Language_Execute_Chrono = 0;
     TLINCL();
     Language_Execute_quantaCount = 20;
+    Language_Execute_switchCount = 0;
     TLINCL();
     Language_Execute_processCount = 0;
     TLSETL(101559);
@@ -3284,9 +3296,9 @@ void Language_Execute () {
     TLINCL();
     {
 	register TLint4	i;
-	for (i = 1; i <= 20; i++) {
+	for (i = 1; i <= TL_TLI_MAXSTREAM; i++) {
 	    TLSETL(100195);
-	    Language_Execute_fileMap[TLINRANGELOW(i, -2, 20, 1)] = -3;
+	    Language_Execute_fileMap[TLINRANGELOW(i, -2, TL_TLI_MAXSTREAM, 1)] = -3;
 	    TLINCL();
 	    Language_Execute_argumentNames[TLINRANGELOW(i, 0, 20, 1)] = (Language_StringDef *) 0;
 	};
@@ -232,13 +232,13 @@ extern void Language_Execute_Executor ();
 extern void Language_Execute_EndExecution ();
 
 extern void Language_Execute_RecoverAllMemory ();
-extern TLint2	Language_Execute_executionTimeout;
+extern TLVMSTATE TLint2	Language_Execute_executionTimeout;
 extern TLboolean	Language_Execute_externalExecutionTimeoutFlag;
-extern TLint4	Language_Execute_stackAllocated;
-extern TLboolean	Language_Execute_allWaitingForKeyboard;
-extern TLboolean	Language_Execute_allWaitingForMouse;
-extern TLboolean	Language_Execute_allWaitingForDelay;
-extern TLint4	Language_Execute_minimumDelayCount;
+extern TLVMSTATE TLint4	Language_Execute_stackAllocated;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForMouse;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForDelay;
+extern TLVMSTATE TLint4	Language_Execute_minimumDelayCount;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -472,13 +472,13 @@ extern TLboolean MIO_PlayDone ();
 extern void MIO_RegisterOpen ();
 
 extern void MIO_RegisterClose ();
-extern TLnat2	Language_Execute_numArguments;
-typedef	TLint1	Language_Execute___x1451[23];
-extern Language_Execute___x1451	Language_Execute_fileMap;
+extern TLVMSTATE TLnat2	Language_Execute_numArguments;
+typedef	TLint2	Language_Execute___x1451[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE Language_Execute___x1451	Language_Execute_fileMap;
 typedef	Language_StringDef	*Language_Execute___x1454[21];
-extern Language_Execute___x1454	Language_Execute_argumentNames;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+extern TLVMSTATE Language_Execute___x1454	Language_Execute_argumentNames;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 struct	Language_Execute_LibraryAbort {
     TLint4	quitCode;
     TLstring	errorMsg;
@@ -518,7 +518,9 @@ struct	Language_Execute_ProcessDescriptor {
     TLnat4	waitParameter;
     struct Language_Execute_ConditionDescriptor	*waitCondition;
     struct Language_Execute_ProcessDescriptor	*nextTimeout;
+    struct Language_Execute_ProcessDescriptor	*prevTimeout;
     TLnat4	totalPause;
+    TLnat4	switches;
     struct Language_Execute_HandlerArea	*activeHandler;
     struct Language_Execute_HandlerArea	*runningHandler;
 };
@@ -544,12 +546,14 @@ struct	Language_Execute_ConditionDefinition {
     TLaddressint	name;
     struct Language_Execute_ConditionDefinition	*nextVariable;
 };
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
-extern TLnat4	Language_Execute_Chrono;
-extern TLint4	Language_Execute_processCount;
-extern TLaddressint	Language_Execute_globalPC;
-extern TLaddressint	Language_Execute_globalSP;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
+extern TLVMSTATE TLnat4	Language_Execute_Chrono;
+extern TLVMSTATE TLint4	Language_Execute_processCount;
+extern TLVMSTATE TLint4	Language_Execute_quantaCount;
+extern TLVMSTATE TLint4	Language_Execute_quantum;
+extern TLVMSTATE TLaddressint	Language_Execute_globalPC;
+extern TLVMSTATE TLaddressint	Language_Execute_globalSP;
 typedef	Language_Opcode	Language_Execute___x1456[1];
 extern Language_Execute___x1456	Language_Execute_nullRoutine;
 
@@ -573,6 +577,8 @@ void Language_Execute_SetActive ();
 
 TLboolean Language_Execute_Kernel_ConditionEmpty ();
 
+void Language_Execute_Kernel_EndSlice ();
+
 TLnat4 Language_Execute_Kernel_GetProcessPriority ();
 
 void Language_Execute_Kernel_Initialize ();
@@ -595,6 +601,8 @@ void Language_Execute_Kernel_RunQueueInsert ();
 
 void Language_Execute_Kernel_SetProcessPriority ();
 
+void Language_Execute_Kernel_SetSlice ();
+
 void Language_Execute_Kernel_SignalDeferredCondition ();
 
 void Language_Execute_Kernel_SignalPriorityCondition ();
@@ -612,9 +620,235 @@ void Language_Execute_Kernel_WaitPriorityCondition ();
 void Language_Execute_Kernel_WaitRegularCondition ();
 
 void Language_Execute_Kernel_WaitTimeoutCondition ();
-static TLnat4	Language_Execute_Kernel_randomNumber;
-static struct Language_Execute_ProcessDescriptor	*Language_Execute_Kernel_TQHead;
-static struct Language_Execute_MonitorDescriptor	*Language_Execute_Kernel_MLHead;
+static TLVMSTATE TLnat4	Language_Execute_Kernel_randomNumber;
+static TLVMSTATE struct Language_Execute_MonitorDescriptor	*Language_Execute_Kernel_MLHead;
+
+/*
+ * The run queue is still the list through nextProcess in dispatch order,
+ * and the executor pops the running process off its head in many places.
+ * RQPrio and RQTail hold each priority on the queue, in ascending order,
+ * with the last process that has it, so an insert finds its place with a
+ * binary search instead of a walk.  Since pops only ever take the head,
+ * the table is brought up to date when it is next used by dropping the
+ * priorities below the head's.
+ */
+#define Language_Execute_Kernel_RQSize	64
+static TLVMSTATE TLint4	Language_Execute_Kernel_RQPrio[Language_Execute_Kernel_RQSize];
+static TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_Kernel_RQTail[Language_Execute_Kernel_RQSize];
+static TLVMSTATE TLint4	Language_Execute_Kernel_RQCount;
+/* Too many priorities at once: walk the queue until it next empties */
+static TLVMSTATE TLboolean	Language_Execute_Kernel_RQWalk;
+
+/*
+ * Processes waiting for a time (pause, or a wait with a timeout) are kept
+ * in a hierarchical timing wheel keyed by the Chrono they wake at, which
+ * is held in waitParameter.  Level 0 has a slot for each tick of the block
+ * of 256 that Chrono is in; levels 1 to 4 have 64 slots, one for each
+ * block of the level below within Chrono's block at that level.  A
+ * process goes in the lowest level whose block it shares with Chrono.
+ * Chrono only moves when nothing can run, and then straight to the next
+ * wake up, so a block is only cascaded down once everything below it has
+ * woken.  Wake ups past the point where Chrono wraps around wait in
+ * TWLater.
+ */
+struct	Language_Execute_Kernel_Slot {
+    struct Language_Execute_ProcessDescriptor	*head;
+    struct Language_Execute_ProcessDescriptor	*tail;
+};
+#define Language_Execute_Kernel_TWSize	(256 + 4 * 64)
+static TLVMSTATE struct Language_Execute_Kernel_Slot	Language_Execute_Kernel_TW[Language_Execute_Kernel_TWSize];
+static TLVMSTATE struct Language_Execute_Kernel_Slot	Language_Execute_Kernel_TWLater;
+static TLVMSTATE TLnat4	Language_Execute_Kernel_TWCount;
+
+/*
+ * How the running process is preempted by others of its priority; see
+ * SetSlice.  The executor counts quantaCount down from quantum and calls
+ * TimeSlice when it runs out.
+ */
+#define Language_Execute_Kernel_SliceRandom	0
+#define Language_Execute_Kernel_SliceInstructions	1
+#define Language_Execute_Kernel_SliceMilliseconds	2
+#define Language_Execute_Kernel_SliceSkipAlone	16
+/* Instructions between looks at the clock for SliceMilliseconds */
+#define Language_Execute_Kernel_SliceCheck	1000
+/* quantaCount while SliceSkipAlone has nothing to switch to */
+#define Language_Execute_Kernel_SliceOpen	0x7fffffff
+extern int MIOTime_GetTicks ();
+static TLVMSTATE TLint4	Language_Execute_Kernel_slicePolicy;
+static TLVMSTATE TLint4	Language_Execute_Kernel_sliceLength;
+/* The slice in progress, which ends if its owner is switched out */
+static TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_Kernel_sliceOwner;
+static TLVMSTATE TLnat4	Language_Execute_Kernel_sliceSwitches;
+static TLVMSTATE TLint4	Language_Execute_Kernel_sliceStart;
+static TLVMSTATE TLboolean	Language_Execute_Kernel_sliceOpen;
+/* randomNumber before a SliceRandom slice's draws, and how many were made */
+static TLVMSTATE TLnat4	Language_Execute_Kernel_sliceSeed;
+static TLVMSTATE TLint4	Language_Execute_Kernel_sliceDraws;
+
+/* Build the table from scratch, for a queue it has not seen being built */
+static void Language_Execute_Kernel_RunQueueIndex () {
+    register struct Language_Execute_ProcessDescriptor	*pd;
+    register TLint4	n;
+    n = 0;
+    for (pd = Language_Execute_RQHead; pd != ((struct Language_Execute_ProcessDescriptor *) 0); pd = pd->nextProcess) {
+	if ((n > 0) && ((Language_Execute_Kernel_RQPrio[n - 1]) == (pd->dispatchPriority))) {
+	    Language_Execute_Kernel_RQTail[n - 1] = pd;
+	} else if (n < Language_Execute_Kernel_RQSize) {
+	    Language_Execute_Kernel_RQPrio[n] = pd->dispatchPriority;
+	    Language_Execute_Kernel_RQTail[n] = pd;
+	    n++;
+	} else {
+	    Language_Execute_Kernel_RQWalk = 1;
+	    break;
+	};
+    };
+    Language_Execute_Kernel_RQCount = n;
+}
+
+/* Forget the priorities of the processes popped off the head since */
+static void Language_Execute_Kernel_RunQueueTrim () {
+    register TLint4	drop;
+    register TLint4	i;
+    if (Language_Execute_RQHead == ((struct Language_Execute_ProcessDescriptor *) 0)) {
+	Language_Execute_Kernel_RQCount = 0;
+	Language_Execute_Kernel_RQWalk = 0;
+	return;
+    };
+    if (Language_Execute_Kernel_RQWalk) {
+	return;
+    };
+    drop = 0;
+    while ((drop < Language_Execute_Kernel_RQCount) && ((Language_Execute_Kernel_RQPrio[drop]) < (Language_Execute_RQHead->dispatchPriority))) {
+	drop++;
+    };
+    if (drop == Language_Execute_Kernel_RQCount) {
+	Language_Execute_Kernel_RunQueueIndex();
+	return;
+    };
+    if (drop > 0) {
+	Language_Execute_Kernel_RQCount -= drop;
+	for (i = 0; i < Language_Execute_Kernel_RQCount; i++) {
+	    Language_Execute_Kernel_RQPrio[i] = Language_Execute_Kernel_RQPrio[i + drop];
+	    Language_Execute_Kernel_RQTail[i] = Language_Execute_Kernel_RQTail[i + drop];
+	};
+    };
+}
+
+/* The slot of the wheel a process waking at wake belongs in now */
+static struct Language_Execute_Kernel_Slot *Language_Execute_Kernel_TimeoutSlot (wake)
+register TLnat4	wake;
+{
+    register TLnat4	diff;
+    if (wake < Language_Execute_Chrono) {
+	return (&(Language_Execute_Kernel_TWLater));
+    };
+    diff = wake ^ Language_Execute_Chrono;
+    if (diff < 0x100) {
+	return (&(Language_Execute_Kernel_TW[wake & 255]));
+    } else if (diff < 0x4000) {
+	return (&(Language_Execute_Kernel_TW[256 + ((wake >> 8) & 63)]));
+    } else if (diff < 0x100000) {
+	return (&(Language_Execute_Kernel_TW[320 + ((wake >> 14) & 63)]));
+    } else if (diff < 0x4000000) {
+	return (&(Language_Execute_Kernel_TW[384 + ((wake >> 20) & 63)]));
+    };
+    return (&(Language_Execute_Kernel_TW[448 + ((wake >> 26) & 63)]));
+}
+
+static void Language_Execute_Kernel_TimeoutLink (pd)
+register struct Language_Execute_ProcessDescriptor	*pd;
+{
+    register struct Language_Execute_Kernel_Slot	*slot;
+    slot = Language_Execute_Kernel_TimeoutSlot(pd->waitParameter);
+    pd->nextTimeout = (struct Language_Execute_ProcessDescriptor *) 0;
+    pd->prevTimeout = slot->tail;
+    if ((slot->tail) != ((struct Language_Execute_ProcessDescriptor *) 0)) {
+	slot->tail->nextTimeout = pd;
+    } else {
+	slot->head = pd;
+    };
+    slot->tail = pd;
+}
+
+static void Language_Execute_Kernel_TimeoutQueueRemove (pd)
+register struct Language_Execute_ProcessDescriptor	*pd;
+{
+    register struct Language_Execute_Kernel_Slot	*slot;
+    slot = Language_Execute_Kernel_TimeoutSlot(pd->waitParameter);
+    if ((pd->prevTimeout) != ((struct Language_Execute_ProcessDescriptor *) 0)) {
+	pd->prevTimeout->nextTimeout = pd->nextTimeout;
+    } else {
+	slot->head = pd->nextTimeout;
+    };
+    if ((pd->nextTimeout) != ((struct Language_Execute_ProcessDescriptor *) 0)) {
+	pd->nextTimeout->prevTimeout = pd->prevTimeout;
+    } else {
+	slot->tail = pd->prevTimeout;
+    };
+    Language_Execute_Kernel_TWCount -= 1;
+}
+
+/*
+ * Move Chrono on to the next wake up and return the slot of the processes
+ * that wake then, cascading blocks down the wheel on the way.
+ */
+static struct Language_Execute_Kernel_Slot *Language_Execute_Kernel_TimeoutQueueNext () {
+    register struct Language_Execute_Kernel_Slot	*slot;
+    register struct Language_Execute_ProcessDescriptor	*pd;
+    register struct Language_Execute_ProcessDescriptor	*next;
+    register TLint4	level;
+    register TLint4	shift;
+    register TLint4	i;
+    for(;;) {
+	for (i = Language_Execute_Chrono & 255; i < 256; i++) {
+	    slot = &(Language_Execute_Kernel_TW[i]);
+	    if ((slot->head) != ((struct Language_Execute_ProcessDescriptor *) 0)) {
+		Language_Execute_Chrono = (Language_Execute_Chrono & ~((TLnat4) 255)) | i;
+		return (slot);
+	    };
+	};
+	slot = (struct Language_Execute_Kernel_Slot *) 0;
+	for (level = 1; level <= 4; level++) {
+	    shift = 2 + (6 * level);
+	    for (i = ((Language_Execute_Chrono >> shift) & 63) + 1; i < 64; i++) {
+		if ((Language_Execute_Kernel_TW[(192 + (64 * level)) + i].head) != ((struct Language_Execute_ProcessDescriptor *) 0)) {
+		    slot = &(Language_Execute_Kernel_TW[(192 + (64 * level)) + i]);
+		    break;
+		};
+	    };
+	    if (slot != ((struct Language_Execute_Kernel_Slot *) 0)) {
+		break;
+	    };
+	};
+	if (slot != ((struct Language_Execute_Kernel_Slot *) 0)) {
+	    Language_Execute_Chrono = (Language_Execute_Chrono & ~((((TLnat4) 64) << shift) - 1)) | (((TLnat4) i) << shift);
+	} else {
+	    slot = &(Language_Execute_Kernel_TWLater);
+	    Language_Execute_Chrono = 0;
+	};
+	pd = slot->head;
+	slot->head = (struct Language_Execute_ProcessDescriptor *) 0;
+	slot->tail = (struct Language_Execute_ProcessDescriptor *) 0;
+	while (pd != ((struct Language_Execute_ProcessDescriptor *) 0)) {
+	    next = pd->nextTimeout;
+	    Language_Execute_Kernel_TimeoutLink(pd);
+	    pd = next;
+	};
+    };
+}
+
+static void Language_Execute_Kernel_QueueReset () {
+    register TLint4	i;
+    Language_Execute_Kernel_RQCount = 0;
+    Language_Execute_Kernel_RQWalk = 0;
+    for (i = 0; i < Language_Execute_Kernel_TWSize; i++) {
+	Language_Execute_Kernel_TW[i].head = (struct Language_Execute_ProcessDescriptor *) 0;
+	Language_Execute_Kernel_TW[i].tail = (struct Language_Execute_ProcessDescriptor *) 0;
+    };
+    Language_Execute_Kernel_TWLater.head = (struct Language_Execute_ProcessDescriptor *) 0;
+    Language_Execute_Kernel_TWLater.tail = (struct Language_Execute_ProcessDescriptor *) 0;
+    Language_Execute_Kernel_TWCount = 0;
+}
 
 void Language_Execute_Kernel_RunQueueInsert (pd)
 register struct Language_Execute_ProcessDescriptor	*pd;
@@ -625,21 +859,64 @@ register struct Language_Execute_ProcessDescriptor	*pd;
     TLSTKCHKSLF(100118);
     TLSETF();
     TLSETL(100118);
-    next = Language_Execute_RQHead;
-    TLINCL();
-    last = (struct Language_Execute_ProcessDescriptor *) 0;
+    /* Something else may be able to run, so end a slice TimeSlice left open */
+    if (Language_Execute_Kernel_sliceOpen) {
+	Language_Execute_Kernel_sliceOpen = 0;
+	Language_Execute_quantaCount = Language_Execute_quantum;
+    };
+    Language_Execute_Kernel_RunQueueTrim();
     TLINCL();
     prio = pd->dispatchPriority;
-    TLSETL(100123);
-    for(;;) {
+    if (Language_Execute_Kernel_RQWalk) {
+	next = Language_Execute_RQHead;
+	TLINCL();
+	last = (struct Language_Execute_ProcessDescriptor *) 0;
 	TLSETL(100123);
-	if ((next == ((struct Language_Execute_ProcessDescriptor *) 0)) || (prio < (next->dispatchPriority))) {
-	    break;
+	for(;;) {
+	    TLSETL(100123);
+	    if ((next == ((struct Language_Execute_ProcessDescriptor *) 0)) || (prio < (next->dispatchPriority))) {
+		break;
+	    };
+	    TLSETL(100125);
+	    last = next;
+	    TLINCL();
+	    next = next->nextProcess;
+	};
+    } else {
+	register TLint4	lo;
+	register TLint4	hi;
+	register TLint4	mid;
+	/* Go after the last process of the highest priority up to prio */
+	lo = 0;
+	hi = Language_Execute_Kernel_RQCount;
+	while (lo < hi) {
+	    mid = (lo + hi) >> 1;
+	    if ((Language_Execute_Kernel_RQPrio[mid]) <= prio) {
+		lo = mid + 1;
+	    } else {
+		hi = mid;
+	    };
+	};
+	if (lo > 0) {
+	    last = Language_Execute_Kernel_RQTail[lo - 1];
+	    next = last->nextProcess;
+	} else {
+	    last = (struct Language_Execute_ProcessDescriptor *) 0;
+	    next = Language_Execute_RQHead;
+	};
+	if ((lo > 0) && ((Language_Execute_Kernel_RQPrio[lo - 1]) == prio)) {
+	    Language_Execute_Kernel_RQTail[lo - 1] = pd;
+	} else if (Language_Execute_Kernel_RQCount < Language_Execute_Kernel_RQSize) {
+	    for (mid = Language_Execute_Kernel_RQCount; mid > lo; mid--) {
+		Language_Execute_Kernel_RQPrio[mid] = Language_Execute_Kernel_RQPrio[mid - 1];
+		Language_Execute_Kernel_RQTail[mid] = Language_Execute_Kernel_RQTail[mid - 1];
+	    };
+	    Language_Execute_Kernel_RQPrio[lo] = prio;
+	    Language_Execute_Kernel_RQTail[lo] = pd;
+	    Language_Execute_Kernel_RQCount += 1;
+	} else {
+	    Language_Execute_Kernel_RQWalk = 1;
 	};
-	TLSETL(100125);
-	last = next;
-	TLINCL();
-	next = next->nextProcess;
     };
     TLSETL(100129);
     pd->nextProcess = next;
@@ -656,15 +933,20 @@ register struct Language_Execute_ProcessDescriptor	*pd;
 
 static void Language_Execute_Kernel_TimeoutQueueDispatch () {
     register struct Language_Execute_ProcessDescriptor	*pd;
+    register struct Language_Execute_ProcessDescriptor	*nextPD;
+    register struct Language_Execute_Kernel_Slot	*slot;
     TLSTKCHKSLF(100139);
     TLSETF();
     TLSETL(100139);
-    pd = Language_Execute_Kernel_TQHead;
-    TLSETL(100141);
-    Language_Execute_Chrono += pd->waitParameter;
+    slot = Language_Execute_Kernel_TimeoutQueueNext();
+    pd = slot->head;
+    slot->head = (struct Language_Execute_ProcessDescriptor *) 0;
+    slot->tail = (struct Language_Execute_ProcessDescriptor *) 0;
     TLSETL(100143);
     for(;;) {
 	TLSETL(100143);
+	nextPD = pd->nextTimeout;
+	Language_Execute_Kernel_TWCount -= 1;
 	if ((pd->waitCondition) != ((struct Language_Execute_ConditionDescriptor *) 0)) {
 	    struct Language_Execute_ConditionDescriptor	*cd;
 	    register struct Language_Execute_MonitorDescriptor	*md;
@@ -722,14 +1004,12 @@ static void Language_Execute_Kernel_TimeoutQueueDispatch () {
 	    Language_Execute_Kernel_RunQueueInsert(pd);
 	};
 	TLSETL(100195);
-	pd = pd->nextTimeout;
+	pd = nextPD;
 	TLINCL();
-	if ((pd == ((struct Language_Execute_ProcessDescriptor *) 0)) || ((pd->waitParameter) > 0)) {
+	if (pd == ((struct Language_Execute_ProcessDescriptor *) 0)) {
 	    break;
 	};
     };
-    TLSETL(100199);
-    Language_Execute_Kernel_TQHead = pd;
     TLRESTORELF();
 }
 
@@ -747,7 +1027,7 @@ void Language_Execute_Kernel_RunQueueDispatch () {
 	    break;
 	};
 	TLSETL(100207);
-	if (Language_Execute_Kernel_TQHead == ((struct Language_Execute_ProcessDescriptor *) 0)) {
+	if (Language_Execute_Kernel_TWCount == 0) {
 	    break;
 	};
 	TLSETL(100211);
@@ -881,7 +1161,8 @@ void Language_Execute_Kernel_Initialize () {
     TLSETL(100292);
     Language_Execute_Kernel_randomNumber = 5407;
     TLINCL();
-    Language_Execute_Kernel_TQHead = (struct Language_Execute_ProcessDescriptor *) 0;
+    Language_Execute_Kernel_SetSlice((TLint4) 0, (TLint4) 20);
+    Language_Execute_Kernel_QueueReset();
     TLINCL();
     Language_Execute_Kernel_MLHead = (struct Language_Execute_MonitorDescriptor *) 0;
     TLRESTORELF();
@@ -891,47 +1172,12 @@ static void Language_Execute_Kernel_TimeoutQueueInsert (pd, timeInterval)
 register struct Language_Execute_ProcessDescriptor	*pd;
 TLnat4	timeInterval;
 {
-    register struct Language_Execute_ProcessDescriptor	*next;
-    register struct Language_Execute_ProcessDescriptor	*last;
-    register TLnat4	timeLeft;
     TLSTKCHKSLF(100398);
     TLSETF();
     TLSETL(100398);
-    next = Language_Execute_Kernel_TQHead;
-    TLINCL();
-    last = (struct Language_Execute_ProcessDescriptor *) 0;
-    TLINCL();
-    timeLeft = timeInterval;
-    TLSETL(100403);
-    for(;;) {
-	TLSETL(100403);
-	if ((next == ((struct Language_Execute_ProcessDescriptor *) 0)) || (timeLeft < (next->waitParameter))) {
-	    break;
-	};
-	TLSETL(100405);
-	timeLeft -= next->waitParameter;
-	TLINCL();
-	last = next;
-	TLINCL();
-	next = next->nextTimeout;
-    };
-    TLSETL(100410);
-    pd->nextTimeout = next;
-    TLINCL();
-    if (last != ((struct Language_Execute_ProcessDescriptor *) 0)) {
-	TLSETL(100412);
-	last->nextTimeout = pd;
-    } else {
-	TLSETL(100414);
-	Language_Execute_Kernel_TQHead = pd;
-    };
-    TLSETL(100417);
-    pd->waitParameter = timeLeft;
-    TLINCL();
-    if (next != ((struct Language_Execute_ProcessDescriptor *) 0)) {
-	TLSETL(100419);
-	next->waitParameter -= timeLeft;
-    };
+    pd->waitParameter = Language_Execute_Chrono + timeInterval;
+    Language_Execute_Kernel_TimeoutLink(pd);
+    Language_Execute_Kernel_TWCount += 1;
     TLRESTORELF();
 }
 
@@ -1299,24 +1545,133 @@ register struct Language_Execute_MonitorDescriptor	*md;
     TLRESTORELF();
 }
 
+/*
+ * SliceRandom is the classic policy: once a process has run quantum
+ * instructions, each further instruction has about a 1 in 16 chance of
+ * a switch.  The draws are made all at once, so the executor is only
+ * called back at the instruction that switches; if the process stops
+ * first, EndSlice takes back the draws for the instructions it did not
+ * run, so the sequence is the same as drawing one at a time.
+ * SliceInstructions switches after every quantum instructions, and
+ * SliceMilliseconds after about quantum milliseconds.  With SliceSkipAlone added, a process that
+ * is the only one able to run is left alone until RunQueueInsert adds
+ * another.
+ */
+void Language_Execute_Kernel_SetSlice (policy, quantum)
+TLint4	policy;
+TLint4	quantum;
+{
+    TLint4	kind;
+    kind = policy & (~Language_Execute_Kernel_SliceSkipAlone);
+    if ((kind < Language_Execute_Kernel_SliceRandom) || (kind > Language_Execute_Kernel_SliceMilliseconds) || (quantum <= 0)) {
+	Language_Execute_ExecutionError_Abort((TLint4) 10000, "Illegal time slice passed to \'Concurrency.SetSlice\'");
+    };
+    Language_Execute_Kernel_slicePolicy = policy;
+    if (kind == Language_Execute_Kernel_SliceMilliseconds) {
+	Language_Execute_Kernel_sliceLength = quantum;
+	Language_Execute_quantum = Language_Execute_Kernel_SliceCheck;
+    } else {
+	Language_Execute_quantum = quantum;
+    };
+    Language_Execute_Kernel_sliceOwner = (struct Language_Execute_ProcessDescriptor *) 0;
+    Language_Execute_Kernel_sliceOpen = 0;
+    Language_Execute_Kernel_sliceDraws = 0;
+    Language_Execute_quantaCount = Language_Execute_quantum;
+}
+
 void Language_Execute_Kernel_TimeSlice () {
+    register struct Language_Execute_ProcessDescriptor	*pd;
+    TLint4	now;
+    TLint4	draws;
+    TLboolean	sameSlice;
     TLSTKCHKSLF(100663);
     TLSETF();
     TLSETL(100663);
-    Language_Execute_Kernel_randomNumber = (Language_Execute_Kernel_randomNumber * 5407) + 1;
-    TLINCL();
-    if ((Language_Execute_Kernel_randomNumber & 132105) == 0) {
-	register struct Language_Execute_ProcessDescriptor	*pd;
-	TLSETL(100665);
-	pd = Language_Execute_RQHead;
-	TLINCL();
-	Language_Execute_RQHead = pd->nextProcess;
-	TLSETL(100668);
-	Language_Execute_Kernel_RunQueueInsert(pd);
+    pd = Language_Execute_RQHead;
+    sameSlice = (pd == Language_Execute_Kernel_sliceOwner) && ((pd->switches) == Language_Execute_Kernel_sliceSwitches);
+    Language_Execute_quantaCount = Language_Execute_quantum;
+    if (((Language_Execute_Kernel_slicePolicy & Language_Execute_Kernel_SliceSkipAlone) != 0) && (pd->nextProcess == ((struct Language_Execute_ProcessDescriptor *) 0))) {
+	Language_Execute_Kernel_sliceOpen = 1;
+	Language_Execute_quantaCount = Language_Execute_Kernel_SliceOpen;
+	TLRESTORELF();
+	return;
+    };
+    switch (Language_Execute_Kernel_slicePolicy & (~Language_Execute_Kernel_SliceSkipAlone)) {
+	case Language_Execute_Kernel_SliceInstructions:
+	    break;
+	case Language_Execute_Kernel_SliceMilliseconds:
+	    now = MIOTime_GetTicks();
+	    if (! sameSlice) {
+		Language_Execute_Kernel_sliceOwner = pd;
+		Language_Execute_Kernel_sliceSwitches = pd->switches;
+		Language_Execute_Kernel_sliceStart = now;
+		TLRESTORELF();
+		return;
+	    };
+	    if ((now - Language_Execute_Kernel_sliceStart) < Language_Execute_Kernel_sliceLength) {
+		TLRESTORELF();
+		return;
+	    };
+	    Language_Execute_Kernel_sliceOwner = (struct Language_Execute_ProcessDescriptor *) 0;
+	    break;
+	default:
+	    if (! sameSlice) {
+		/* Draw for each instruction up to the one that switches */
+		Language_Execute_Kernel_sliceSeed = Language_Execute_Kernel_randomNumber;
+		draws = 0;
+		do {
+		    Language_Execute_Kernel_randomNumber = (Language_Execute_Kernel_randomNumber * 5407) + 1;
+		    draws++;
+		} while ((Language_Execute_Kernel_randomNumber & 132105) != 0);
+		TLINCL();
+		if (draws > 1) {
+		    Language_Execute_Kernel_sliceOwner = pd;
+		    Language_Execute_Kernel_sliceSwitches = pd->switches;
+		    Language_Execute_Kernel_sliceDraws = draws;
+		    Language_Execute_quantaCount = draws - 1;
+		    TLRESTORELF();
+		    return;
+		};
+	    };
+	    Language_Execute_Kernel_sliceOwner = (struct Language_Execute_ProcessDescriptor *) 0;
+	    Language_Execute_Kernel_sliceDraws = 0;
+	    break;
+    };
+    TLSETL(100665);
+    Language_Execute_RQHead = pd->nextProcess;
+    TLSETL(100668);
+    Language_Execute_Kernel_RunQueueInsert(pd);
+    if ((Language_Execute_RQHead == pd) && ((Language_Execute_Kernel_slicePolicy & (~Language_Execute_Kernel_SliceSkipAlone)) == Language_Execute_Kernel_SliceRandom)) {
+	/* Still first in line, so keep drawing from the next instruction */
+	Language_Execute_quantaCount = 0;
     };
     TLRESTORELF();
 }
 
+/*
+ * Called by the executor when pd stops running before its SliceRandom
+ * slice reaches the switch: it blocked, paused, ended or was preempted.
+ * One draw was made for each instruction up to the switch, but only the
+ * first and one for each instruction counted off since were due, so
+ * rewind randomNumber to the rest and leave the slice expired, with the
+ * next instruction counted drawing again.
+ */
+void Language_Execute_Kernel_EndSlice (pd)
+struct Language_Execute_ProcessDescriptor	*pd;
+{
+    TLint4	draws;
+    if ((Language_Execute_Kernel_sliceDraws == 0) || (pd != Language_Execute_Kernel_sliceOwner) || ((pd->switches) != Language_Execute_Kernel_sliceSwitches)) {
+	return;
+    };
+    Language_Execute_Kernel_randomNumber = Language_Execute_Kernel_sliceSeed;
+    for (draws = Language_Execute_Kernel_sliceDraws - Language_Execute_quantaCount; draws > 0; draws--) {
+	Language_Execute_Kernel_randomNumber = (Language_Execute_Kernel_randomNumber * 5407) + 1;
+    };
+    Language_Execute_Kernel_sliceOwner = (struct Language_Execute_ProcessDescriptor *) 0;
+    Language_Execute_Kernel_sliceDraws = 0;
+    Language_Execute_quantaCount = 0;
+}
+
 void Language_Execute_Kernel_SignalTimeoutCondition (cd)
 register struct Language_Execute_ConditionDescriptor	*cd;
 {
@@ -1333,30 +1688,7 @@ register struct Language_Execute_ConditionDescriptor	*cd;
 	return;
     };
     TLSETL(100684);
-    if (Language_Execute_Kernel_TQHead == pd) {
-	TLSETL(100685);
-	Language_Execute_Kernel_TQHead = pd->nextTimeout;
-    } else {
-	register struct Language_Execute_ProcessDescriptor	*last;
-	TLSETL(100687);
-	last = Language_Execute_Kernel_TQHead;
-	TLSETL(100690);
-	for(;;) {
-	    TLSETL(100690);
-	    if ((last->nextTimeout) == pd) {
-		break;
-	    };
-	    TLSETL(100691);
-	    last = last->nextTimeout;
-	};
-	TLSETL(100693);
-	last->nextTimeout = pd->nextTimeout;
-    };
-    TLSETL(100695);
-    if ((pd->nextTimeout) != ((struct Language_Execute_ProcessDescriptor *) 0)) {
-	TLSETL(100696);
-	pd->nextTimeout->waitParameter += pd->waitParameter;
-    };
+    Language_Execute_Kernel_TimeoutQueueRemove(pd);
     TLSETL(100703);
     md = cd->md;
     TLSETL(100705);
@@ -1429,8 +1761,9 @@ void Language_Execute_Kernel () {
     TLSETF();
     TLSETL(100109);
     Language_Execute_Kernel_randomNumber = 5407;
+    Language_Execute_Kernel_SetSlice((TLint4) 0, (TLint4) 20);
     TLSETL(100112);
-    Language_Execute_Kernel_TQHead = (struct Language_Execute_ProcessDescriptor *) 0;
+    Language_Execute_Kernel_QueueReset();
     TLSETL(100114);
     Language_Execute_Kernel_MLHead = (struct Language_Execute_MonitorDescriptor *) 0;
     TLRESTORELF();
@@ -201,7 +201,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x1112[22];
-typedef	Language___x1112	Language___x1111[255];
+typedef	Language___x1112	Language___x1111[256];
 Language___x1111	Language_OpcodeName = 
     {"ABORT", "ABORTCOND", "ABSINT", "ABSREAL", "ADDINT", "ADDINTNAT", "ADDNAT", "ADDNATINT", "ADDREAL", "ADDSET",
     "ALLOCFLEXARRAY", "ALLOCGLOB", "ALLOCGLOBARRAY", "ALLOCLOC", "ALLOCLOCARRAY", "AND", "ARRAYUPPER", "ASNADDR", "ASNADDRINV", "ASNINT",
@@ -228,7 +228,7 @@ Language___x1111	Language_OpcodeName =
     "SIGNAL", "STRINT", "STRINTOK", "STRNAT", "STRNATOK", "STRTOCHAR", "SUBINT", "SUBINTNAT", "SUBNAT", "SUBNATINT",
     "SUBREAL", "SUBSCRIPT", "SUBSET", "SUBSTR1", "SUBSTR2", "SUCC", "TAG", "TELL", "UFIELD", "UNINIT",
     "UNINITADDR", "UNINITBOOLEAN", "UNINITINT", "UNINITNAT", "UNINITREAL", "UNINITSTR", "UNLINKHANDLER", "VSUBSCRIPT", "WAIT", "WRITE",
-    "XOR", "XORSET", "BREAK", "SYSEXIT", "ILLEGAL"};
+    "XOR", "XORSET", "BREAK", "SYSEXIT", "ILLEGAL", "CATASN"};
 
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
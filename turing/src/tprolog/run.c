@@ -206,13 +206,13 @@ extern void Language_Execute_Executor ();
 extern void Language_Execute_EndExecution ();
 
 extern void Language_Execute_RecoverAllMemory ();
-extern TLint2	Language_Execute_executionTimeout;
+extern TLVMSTATE TLint2	Language_Execute_executionTimeout;
 extern TLboolean	Language_Execute_externalExecutionTimeoutFlag;
-extern TLint4	Language_Execute_stackAllocated;
-extern TLboolean	Language_Execute_allWaitingForKeyboard;
-extern TLboolean	Language_Execute_allWaitingForMouse;
-extern TLboolean	Language_Execute_allWaitingForDelay;
-extern TLint4	Language_Execute_minimumDelayCount;
+extern TLVMSTATE TLint4	Language_Execute_stackAllocated;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForMouse;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForDelay;
+extern TLVMSTATE TLint4	Language_Execute_minimumDelayCount;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -310,10 +310,14 @@ void Language_Execute_ExecutionError_Initialize ();
 
 extern void Language_Execute_Heap_Alloc ();
 
+extern void Language_Execute_Heap_AllocStack ();
+
 extern void Language_Execute_Heap_CleanUp ();
 
 extern void Language_Execute_Heap_Dealloc ();
 
+extern void Language_Execute_Heap_DeallocStack ();
+
 extern void Language_Execute_Heap_Free ();
 
 extern void Language_Execute_Heap_New ();
@@ -446,13 +450,13 @@ extern TLboolean MIO_PlayDone ();
 extern void MIO_RegisterOpen ();
 
 extern void MIO_RegisterClose ();
-extern TLnat2	Language_Execute_numArguments;
-typedef	TLint1	Language_Execute___x2028[23];
-extern Language_Execute___x2028	Language_Execute_fileMap;
+extern TLVMSTATE TLnat2	Language_Execute_numArguments;
+typedef	TLint2	Language_Execute___x2028[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE Language_Execute___x2028	Language_Execute_fileMap;
 typedef	Language_StringDef	*Language_Execute___x2031[21];
-extern Language_Execute___x2031	Language_Execute_argumentNames;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+extern TLVMSTATE Language_Execute___x2031	Language_Execute_argumentNames;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 struct	Language_Execute_LibraryAbort {
     TLint4	quitCode;
     TLstring	errorMsg;
@@ -492,7 +496,9 @@ struct	Language_Execute_ProcessDescriptor {
     TLnat4	waitParameter;
     struct Language_Execute_ConditionDescriptor	*waitCondition;
     struct Language_Execute_ProcessDescriptor	*nextTimeout;
+    struct Language_Execute_ProcessDescriptor	*prevTimeout;
     TLnat4	totalPause;
+    TLnat4	switches;
     struct Language_Execute_HandlerArea	*activeHandler;
     struct Language_Execute_HandlerArea	*runningHandler;
 };
@@ -518,12 +524,12 @@ struct	Language_Execute_ConditionDefinition {
     TLaddressint	name;
     struct Language_Execute_ConditionDefinition	*nextVariable;
 };
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
-extern TLnat4	Language_Execute_Chrono;
-extern TLint4	Language_Execute_processCount;
-extern TLaddressint	Language_Execute_globalPC;
-extern TLaddressint	Language_Execute_globalSP;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
+extern TLVMSTATE TLnat4	Language_Execute_Chrono;
+extern TLVMSTATE TLint4	Language_Execute_processCount;
+extern TLVMSTATE TLaddressint	Language_Execute_globalPC;
+extern TLVMSTATE TLaddressint	Language_Execute_globalSP;
 typedef	Language_Opcode	Language_Execute___x2033[1];
 extern Language_Execute___x2033	Language_Execute_nullRoutine;
 
@@ -547,6 +553,8 @@ void Language_Execute_SetActive ();
 
 extern TLboolean Language_Execute_Kernel_ConditionEmpty ();
 
+extern void Language_Execute_Kernel_EndSlice ();
+
 extern TLnat4 Language_Execute_Kernel_GetProcessPriority ();
 
 extern void Language_Execute_Kernel_Initialize ();
@@ -569,6 +577,8 @@ extern void Language_Execute_Kernel_RunQueueInsert ();
 
 extern void Language_Execute_Kernel_SetProcessPriority ();
 
+extern void Language_Execute_Kernel_SetSlice ();
+
 extern void Language_Execute_Kernel_SignalDeferredCondition ();
 
 extern void Language_Execute_Kernel_SignalPriorityCondition ();
@@ -606,7 +616,9 @@ void Language_Execute_DispatchHandler ();
 extern void TLEABT ();
 
 void Language_Execute_ExtraRoutines ();
-extern TLint4	Language_Execute_quantaCount;
+extern TLVMSTATE TLint4	Language_Execute_quantaCount;
+extern TLVMSTATE TLint4	Language_Execute_quantum;
+extern TLVMSTATE TLnat4	Language_Execute_switchCount;
 
 extern void Math_Arctan ();
 
@@ -1380,7 +1392,7 @@ struct Language_Execute_RunDescriptor	*runDesc;
 			register TLaddressint	target;
 			register TLaddressint	source;
 			register TLint4	maxLen;
-			TLstring	tstring;
+			register TLint4	slen;
 			maxLen = (* (TLint4 *) Language_Execute_globalSP);
 			if (op == 45) {
 			    source = (TLaddressint) ((* (TLaddressint *) ((unsigned long) Language_Execute_globalSP + 4)));
@@ -1389,12 +1401,11 @@ struct Language_Execute_RunDescriptor	*runDesc;
 			    target = (TLaddressint) ((* (TLaddressint *) ((unsigned long) Language_Execute_globalSP + 4)));
 			    source = (TLaddressint) ((* (TLaddressint *) (((unsigned long) Language_Execute_globalSP + 4) + 4)));
 			};
-			if (TL_TLS_TLSLEN(((* (TLstring *) source))) > maxLen) {
+			slen = TL_TLS_TLSLEN(((* (TLstring *) source)));
+			if (slen > maxLen) {
 			    TLEABT((TLint4) 35);
 			};
-			strcpy(tstring, (* (TLstring *) source));
-			(* (TLnat1 *) target) = 0;
-			strcpy((* (TLstring *) target), tstring);
+			memmove((* (TLstring *) target), (* (TLstring *) source), slen + 1);
 			Language_Execute_globalSP += 12;
 		    }
 		    break;
@@ -1469,21 +1480,45 @@ struct Language_Execute_RunDescriptor	*runDesc;
 			register TLaddressint	t;
 			register TLaddressint	r;
 			register TLaddressint	l;
+			register TLint4	llen;
+			register TLint4	rlen;
 			t = (TLaddressint) ((* (TLaddressint *) Language_Execute_globalSP));
 			r = (TLaddressint) ((* (TLaddressint *) ((unsigned long) Language_Execute_globalSP + 4)));
 			l = (TLaddressint) ((* (TLaddressint *) ((unsigned long) Language_Execute_globalSP + (2 * 4))));
-			if ((TL_TLS_TLSLEN(((* (TLstring *) l))) + TL_TLS_TLSLEN(((* (TLstring *) r)))) > (255)) {
+			llen = TL_TLS_TLSLEN(((* (TLstring *) l)));
+			rlen = TL_TLS_TLSLEN(((* (TLstring *) r)));
+			if ((llen + rlen) > (255)) {
 			    Language_Execute_ExecutionError_Abort((TLint4) 10000, "String generated by string catenation too long");
 			};
-			{
-			    TLstring	__x2555;
-			    TL_TLS_TLSCAT((* (TLstring *) l), (* (TLstring *) r), __x2555);
-			    TLSTRASS(255, (* (TLstring *) t), __x2555);
-			};
+			TL_TLS_TLSCTN((* (TLstring *) l), (TLint4) llen, (* (TLstring *) r), (TLint4) rlen, (* (TLstring *) t));
 			Language_Execute_globalSP += 8;
 			(* (TLaddressint *) Language_Execute_globalSP) = (TLaddressint) t;
 		    }
 		    break;
+		case 255:
+		    {
+			register TLaddressint	target;
+			register TLaddressint	r;
+			register TLaddressint	l;
+			register TLint4	maxLen;
+			register TLint4	llen;
+			register TLint4	rlen;
+			maxLen = (* (TLint4 *) Language_Execute_globalSP);
+			r = (TLaddressint) ((* (TLaddressint *) ((unsigned long) Language_Execute_globalSP + 4)));
+			l = (TLaddressint) ((* (TLaddressint *) ((unsigned long) Language_Execute_globalSP + (2 * 4))));
+			target = (TLaddressint) ((* (TLaddressint *) ((unsigned long) Language_Execute_globalSP + (3 * 4))));
+			llen = TL_TLS_TLSLEN(((* (TLstring *) l)));
+			rlen = TL_TLS_TLSLEN(((* (TLstring *) r)));
+			if ((llen + rlen) > (255)) {
+			    Language_Execute_ExecutionError_Abort((TLint4) 10000, "String generated by string catenation too long");
+			};
+			if ((llen + rlen) > maxLen) {
+			    TLEABT((TLint4) 35);
+			};
+			TL_TLS_TLSCTN((* (TLstring *) l), (TLint4) llen, (* (TLstring *) r), (TLint4) rlen, (* (TLstring *) target));
+			Language_Execute_globalSP += 16;
+		    }
+		    break;
 		case 62:
 		    {
 			register TLaddressint	stkAddr;
@@ -3221,9 +3256,12 @@ struct Language_Execute_RunDescriptor	*runDesc;
 			sAddr = (TLaddressint) ((* (TLaddressint *) (((unsigned long) Language_Execute_globalSP + 4) + 4)));
 			tAddr = (TLaddressint) ((* (TLaddressint *) Language_Execute_globalSP));
 			Index = (* (TLint4 *) ((unsigned long) Language_Execute_globalSP + 4));
-			slen = TL_TLS_TLSLEN(((* (TLstring *) sAddr)));
 			if (((* (Language_SubstringKind *) Language_Execute_globalPC)) == 1) {
+			    slen = TL_TLS_TLSLEN(((* (TLstring *) sAddr)));
 			    Index += slen;
+			} else {
+			    /* s(i) only needs to know that s is at least i long */
+			    slen = ((Index > 0) && (Index <= 255) && (memchr((char *) sAddr, '\0', Index) == NULL)) ? Index : 0;
 			};
 			if (Index <= 0) {
 			    Language_Execute_ExecutionError_Abort((TLint4) 10000, "Substring index is less than 1");
@@ -3232,12 +3270,8 @@ struct Language_Execute_RunDescriptor	*runDesc;
 				Language_Execute_ExecutionError_Abort((TLint4) 10000, "Substring index is greater than length of string");
 			    };
 			};
-			(* (TLint2 *) tAddr) = 0;
-			{
-			    TLchar	__x3055[2];
-			    TL_TLS_TLSBX(__x3055, (TLint4) Index, ((* (TLstring *) sAddr)));
-			    TLSTRASS(1, (* (Language_string1 *) tAddr), __x3055);
-			};
+			(* (TLchar *) tAddr) = (* (TLchar *) ((unsigned long) sAddr + (Index - 1)));
+			(* (TLchar *) ((unsigned long) tAddr + 1)) = '\0';
 			Language_Execute_globalSP += 8;
 			(* (TLaddressint *) Language_Execute_globalSP) = (TLaddressint) tAddr;
 			Language_Execute_globalPC += Language_codeInt1Size;
@@ -3288,11 +3322,11 @@ struct Language_Execute_RunDescriptor	*runDesc;
 				};
 			    };
 			};
-			(* (TLint2 *) tAddr) = 0;
-			{
-			    TLstring	__x3066;
-			    TL_TLS_TLSBXX(__x3066, (TLint4) lastIndex, (TLint4) firstIndex, ((* (TLstring *) sAddr)));
-			    TLSTRASS(255, (* (TLstring *) tAddr), __x3066);
+			if (lastIndex == slen) {
+			    /* A suffix is already terminated in place: hand back a view of it */
+			    tAddr = (TLaddressint) ((unsigned long) sAddr + (firstIndex - 1));
+			} else {
+			    TL_TLS_TLSBXN((* (TLstring *) tAddr), (TLint4) lastIndex, (TLint4) firstIndex, ((* (TLstring *) sAddr)), (TLint4) slen);
 			};
 			Language_Execute_globalSP += 12;
 			(* (TLaddressint *) Language_Execute_globalSP) = (TLaddressint) tAddr;
@@ -3959,7 +3993,7 @@ struct Language_Execute_RunDescriptor	*runDesc;
 			};
 			stackBase = (TLaddressint) 0;
 			if (stackSize > (formalSize + 12)) {
-			    Language_Execute_Heap_Alloc(&(stackBase), (TLnat4) ((256 + stackSize) + sizeof(struct Language_Execute_ProcessDescriptor)));
+			    Language_Execute_Heap_AllocStack(&(stackBase), (TLnat4) ((256 + stackSize) + sizeof(struct Language_Execute_ProcessDescriptor)));
 			};
 			if ((unsigned long) stackBase == 0) {
 			    if ((unsigned long) status != 0) {
@@ -3979,6 +4013,7 @@ struct Language_Execute_RunDescriptor	*runDesc;
 			    TLSTRASS(255, newProc->prevErrMessage, "");
 			    newProc->name = (TLaddressint) procName;
 			    newProc->totalPause = 0;
+			    newProc->switches = 0;
 			    newProc->activeHandler = (struct Language_Execute_HandlerArea *) 0;
 			    newProc->runningHandler = (struct Language_Execute_HandlerArea *) 0;
 			    tgt = (TLaddressint) (((TLnat4) newProc) - formalSize);
@@ -4491,11 +4526,12 @@ struct Language_Execute_RunDescriptor	*runDesc;
 		    break;
 	    };
 	    if (Language_Execute_RQHead == ((struct Language_Execute_ProcessDescriptor *) 0)) {
+		Language_Execute_Kernel_EndSlice(me);
 		if ((unsigned long) Language_Execute_globalPC == 0) {
 		    TLaddressint	stackBase;
 		    stackBase = (TLaddressint) (me->stackBase);
 		    TLASSERT ((unsigned long) stackBase != 0);
-		    Language_Execute_Heap_Dealloc(&(stackBase));
+		    Language_Execute_Heap_DeallocStack(&(stackBase), (TLnat4) (((unsigned long) me - (unsigned long) stackBase) + sizeof(struct Language_Execute_ProcessDescriptor)));
 		    Language_Execute_processCount -= 1;
 		    me = (struct Language_Execute_ProcessDescriptor *) 0;
 		} else {
@@ -4517,11 +4553,12 @@ struct Language_Execute_RunDescriptor	*runDesc;
 			};
 		    };
 		    if (Language_Execute_RQHead != me) {
+			Language_Execute_Kernel_EndSlice(me);
 			if ((unsigned long) Language_Execute_globalPC == 0) {
 			    TLaddressint	stackBase;
 			    stackBase = (TLaddressint) (me->stackBase);
 			    TLASSERT ((unsigned long) stackBase != 0);
-			    Language_Execute_Heap_Dealloc(&(stackBase));
+			    Language_Execute_Heap_DeallocStack(&(stackBase), (TLnat4) (((unsigned long) me - (unsigned long) stackBase) + sizeof(struct Language_Execute_ProcessDescriptor)));
 			    Language_Execute_processCount -= 1;
 			    me = (struct Language_Execute_ProcessDescriptor *) 0;
 			} else {
@@ -4529,11 +4566,13 @@ struct Language_Execute_RunDescriptor	*runDesc;
 			    me->sp = (TLaddressint) Language_Execute_globalSP;
 			};
 			me = Language_Execute_RQHead;
+			me->switches += 1;
+			Language_Execute_switchCount += 1;
 			Language_Execute_globalPC = (TLaddressint) (me->pc);
 			Language_Execute_globalSP = (TLaddressint) (me->sp);
 			fp = (TLaddressint) (me->fp);
 			Language_Execute_SetActive(&(me->activeStream));
-			Language_Execute_quantaCount = 20;
+			Language_Execute_quantaCount = Language_Execute_quantum;
 		    };
 		};
 	    };
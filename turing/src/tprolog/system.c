@@ -205,13 +205,13 @@ extern void Language_Execute_Executor ();
 extern void Language_Execute_EndExecution ();
 
 extern void Language_Execute_RecoverAllMemory ();
-extern TLint2	Language_Execute_executionTimeout;
+extern TLVMSTATE TLint2	Language_Execute_executionTimeout;
 extern TLboolean	Language_Execute_externalExecutionTimeoutFlag;
-extern TLint4	Language_Execute_stackAllocated;
-extern TLboolean	Language_Execute_allWaitingForKeyboard;
-extern TLboolean	Language_Execute_allWaitingForMouse;
-extern TLboolean	Language_Execute_allWaitingForDelay;
-extern TLint4	Language_Execute_minimumDelayCount;
+extern TLVMSTATE TLint4	Language_Execute_stackAllocated;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForKeyboard;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForMouse;
+extern TLVMSTATE TLboolean	Language_Execute_allWaitingForDelay;
+extern TLVMSTATE TLint4	Language_Execute_minimumDelayCount;
 
 extern void TL_TLB_TLBUUN ();
 
@@ -445,13 +445,13 @@ extern TLboolean MIO_PlayDone ();
 extern void MIO_RegisterOpen ();
 
 extern void MIO_RegisterClose ();
-extern TLnat2	Language_Execute_numArguments;
-typedef	TLint1	Language_Execute___x1614[23];
-extern Language_Execute___x1614	Language_Execute_fileMap;
+extern TLVMSTATE TLnat2	Language_Execute_numArguments;
+typedef	TLint2	Language_Execute___x1614[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE Language_Execute___x1614	Language_Execute_fileMap;
 typedef	Language_StringDef	*Language_Execute___x1617[21];
-extern Language_Execute___x1617	Language_Execute_argumentNames;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+extern TLVMSTATE Language_Execute___x1617	Language_Execute_argumentNames;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 struct	Language_Execute_LibraryAbort {
     TLint4	quitCode;
     TLstring	errorMsg;
@@ -491,7 +491,9 @@ struct	Language_Execute_ProcessDescriptor {
     TLnat4	waitParameter;
     struct Language_Execute_ConditionDescriptor	*waitCondition;
     struct Language_Execute_ProcessDescriptor	*nextTimeout;
+    struct Language_Execute_ProcessDescriptor	*prevTimeout;
     TLnat4	totalPause;
+    TLnat4	switches;
     struct Language_Execute_HandlerArea	*activeHandler;
     struct Language_Execute_HandlerArea	*runningHandler;
 };
@@ -517,12 +519,12 @@ struct	Language_Execute_ConditionDefinition {
     TLaddressint	name;
     struct Language_Execute_ConditionDefinition	*nextVariable;
 };
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
-extern struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
-extern TLnat4	Language_Execute_Chrono;
-extern TLint4	Language_Execute_processCount;
-extern TLaddressint	Language_Execute_globalPC;
-extern TLaddressint	Language_Execute_globalSP;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_RQHead;
+extern TLVMSTATE struct Language_Execute_ProcessDescriptor	*Language_Execute_EQHead;
+extern TLVMSTATE TLnat4	Language_Execute_Chrono;
+extern TLVMSTATE TLint4	Language_Execute_processCount;
+extern TLVMSTATE TLaddressint	Language_Execute_globalPC;
+extern TLVMSTATE TLaddressint	Language_Execute_globalSP;
 typedef	Language_Opcode	Language_Execute___x1619[1];
 extern Language_Execute___x1619	Language_Execute_nullRoutine;
 
@@ -568,6 +570,8 @@ extern void Language_Execute_Kernel_RunQueueInsert ();
 
 extern void Language_Execute_Kernel_SetProcessPriority ();
 
+extern void Language_Execute_Kernel_SetSlice ();
+
 extern void Language_Execute_Kernel_SignalDeferredCondition ();
 
 extern void Language_Execute_Kernel_SignalPriorityCondition ();
@@ -605,7 +609,9 @@ void Language_Execute_DispatchHandler ();
 extern void TLEABT ();
 
 void Language_Execute_ExtraRoutines ();
-extern TLint4	Language_Execute_quantaCount;
+extern TLVMSTATE TLint4	Language_Execute_quantaCount;
+extern TLVMSTATE TLint4	Language_Execute_quantum;
+extern TLVMSTATE TLnat4	Language_Execute_switchCount;
 
 extern void Math_Arctan ();
 
@@ -677,14 +683,20 @@ void Language_Execute_System_Nargs ();
 
 void Language_Execute_System_Setactive ();
 
+void Language_Execute_System_Setslice ();
+
 void Language_Execute_System_Simutime ();
 
+void Language_Execute_System_Switches ();
+
 void Language_Execute_System_Sysclock ();
 
 void Language_Execute_System_System ();
 
 void Language_Execute_System_Time ();
 
+void Language_Execute_System_Totalswitches ();
+
 void Language_Execute_System_Wallclock ();
 extern TLint4	TL_TLI_TLIARC;
 
@@ -810,6 +822,27 @@ TLaddressint	sp;
     };
 }
 
+void Language_Execute_System_Setslice (sp)
+TLaddressint	sp;
+{
+    TLSTACKCHECK();
+    Language_Execute_Kernel_SetSlice((* (TLint4 *) sp), (* (TLint4 *) ((unsigned long) sp + 4)));
+}
+
+void Language_Execute_System_Switches (sp)
+TLaddressint	sp;
+{
+    TLSTACKCHECK();
+    (* (TLint4 *) ((* (TLaddressint *) sp))) = Language_Execute_RQHead->switches;
+}
+
+void Language_Execute_System_Totalswitches (sp)
+TLaddressint	sp;
+{
+    TLSTACKCHECK();
+    (* (TLint4 *) ((* (TLaddressint *) sp))) = Language_Execute_switchCount;
+}
+
 void Language_Execute_System_Simutime (sp)
 TLaddressint	sp;
 {
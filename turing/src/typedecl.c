@@ -341,7 +341,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2761[22];
-typedef	Language___x2761	Language___x2760[255];
+typedef	Language___x2761	Language___x2760[256];
 extern Language___x2760	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
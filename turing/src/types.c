@@ -335,7 +335,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2388[22];
-typedef	Language___x2388	Language___x2387[255];
+typedef	Language___x2388	Language___x2387[256];
 extern Language___x2387	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
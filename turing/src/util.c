@@ -342,7 +342,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2719[22];
-typedef	Language___x2719	Language___x2718[255];
+typedef	Language___x2719	Language___x2718[256];
 extern Language___x2718	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -334,7 +334,7 @@ typedef	TLnat2	Language_set16;
 typedef	TLnat4	Language_set32;
 typedef	TLint2	Language_Opcode;
 typedef	TLchar	Language___x2211[22];
-typedef	Language___x2211	Language___x2210[255];
+typedef	Language___x2211	Language___x2210[256];
 extern Language___x2210	Language_OpcodeName;
 struct	Language_CodeHeader {
     TLaddressint	bodyCode;
@@ -0,0 +1,48 @@
+% Times fork and process exit: a chain of short lived processes, each
+% forking the next, then batches of workers that are alive at once
+const chainLength := 20000
+const batches := 200
+const batchSize := 100
+
+monitor Counter
+    export Add, Count
+    var n : int := 0
+    procedure Add
+	n += 1
+    end Add
+    function Count : int
+	result n
+    end Count
+end Counter
+
+var finished : boolean := false
+
+process Chain (n : int)
+    if n < chainLength then
+	fork Chain (n + 1)
+    else
+	finished := true
+    end if
+end Chain
+
+process Worker
+    Counter.Add
+end Worker
+
+var start := Time.Elapsed
+fork Chain (1)
+loop
+    exit when finished
+end loop
+put "chain:   ", Time.Elapsed - start, " ms (", chainLength, " processes)"
+
+start := Time.Elapsed
+for b : 1 .. batches
+    for i : 1 .. batchSize
+	fork Worker
+    end for
+    loop
+	exit when Counter.Count = b * batchSize
+    end loop
+end for
+put "batches: ", Time.Elapsed - start, " ms (", Counter.Count, " processes)"
@@ -0,0 +1,12 @@
+% Times reading every integer from standard input
+% e.g. run with 10^6 integers piped in
+var n : int := 0
+var start := Time.Elapsed
+loop
+    get skip
+    exit when eof
+    var i : int
+    get i
+    n += 1
+end loop
+put n, " integers: ", Time.Elapsed - start, " ms"
@@ -29,5 +29,60 @@ put ""
 put "successful: ", IntHashMap.Get (h, "yo", res)
 put "should be 7:", res
 
+% Remove every other key, then check that the rest are all still there
+for i : 0 .. 100 by 2
+    IntHashMap.Remove (h, "test " + intstr (i))
+end for
+var missing := 0
+for i : 0 .. 100
+    var got : int
+    if IntHashMap.Get (h, "test " + intstr (i), got) not= i mod 2 or
+	    (i mod 2 = 1 and got not= i) then
+	missing += 1
+    end if
+end for
+put "should be 0: ", missing
+
+% Walk the keys that are left, summing the values and removing as we go
+put "should be 51: ", IntHashMap.Size (h)
+var key : string
+var sum := 0
+var more := IntHashMap.First (h, key, res)
+loop
+    exit when not more
+    sum += res
+    IntHashMap.Remove (h, key)
+    more := IntHashMap.Next (h, key, res)
+end loop
+put "should be 2507 0: ", sum, " ", IntHashMap.Size (h)
+
+% Presize for a known number of keys, then reuse the table
+IntHashMap.Reserve (h, 1000)
+for i : 1 .. 1000
+    IntHashMap.Put (h, intstr (i), i)
+end for
+IntHashMap.Clear (h)
+put "should be 0 0: ", IntHashMap.Size (h), " ", IntHashMap.Get (h, "1", res)
+
+% w24 and w174 hash to the second last slot of a new map and w39 to the
+% last one, so w39 wraps round to the first slot.  Removing w24 part way
+% through the walk moves both of the others back.
+var w : int := IntHashMap.New ()
+IntHashMap.Put (w, "w24", 1)
+IntHashMap.Put (w, "w174", 2)
+IntHashMap.Put (w, "w39", 4)
+sum := 0
+more := IntHashMap.First (w, key, res)
+loop
+    exit when not more
+    sum += res
+    if key = "w24" then
+	IntHashMap.Remove (w, key)
+    end if
+    more := IntHashMap.Next (w, key, res)
+end loop
+put "should be 7 2: ", sum, " ", IntHashMap.Size (w)
+IntHashMap.Free (w)
+
 IntHashMap.Free (h)
 
@@ -0,0 +1,22 @@
+% Times IntHashMap puts, gets and removes on many short keys
+const n := 200000
+var h := IntHashMap.New ()
+var start := Time.Elapsed
+for i : 1 .. n
+    IntHashMap.Put (h, intstr (i), i)
+end for
+put "put:    ", Time.Elapsed - start, " ms (", n, ")"
+
+start := Time.Elapsed
+var found, got : int := 0
+for i : 1 .. 2 * n
+    found += IntHashMap.Get (h, intstr (i), got)
+end for
+put "get:    ", Time.Elapsed - start, " ms (", found, " found)"
+
+start := Time.Elapsed
+for i : 1 .. n
+    IntHashMap.Remove (h, intstr (i))
+end for
+put "remove: ", Time.Elapsed - start, " ms (", n, ")"
+IntHashMap.Free (h)
@@ -0,0 +1,38 @@
+% Holds more than 1000 items at once, which used to run out of IDs
+var ids : array 1 .. 3000 of int
+for i : 1 .. 3000
+    ids (i) := IntIntMap.New
+    IntIntMap.Put (ids (i), i, i * i)
+end for
+put "should be 1: ", ids (2) - ids (1)
+
+var bad := 0
+for i : 1 .. 3000
+    var v : int
+    if not IntIntMap.Get (ids (i), i, v) or v not= i * i then
+	bad += 1
+    end if
+end for
+put "should be 0: ", bad
+
+% Free every other map, then reuse the freed IDs
+for i : 1 .. 3000 by 2
+    IntIntMap.Free (ids (i))
+end for
+for i : 1 .. 3000 by 2
+    ids (i) := IntSet.New
+    IntSet.Add (ids (i), i)
+end for
+bad := 0
+for i : 1 .. 3000
+    if i mod 2 = 1 then
+	bad += IntSet.Size (ids (i)) - 1
+    elsif not IntIntMap.Contains (ids (i), i) then
+	bad += 1
+    end if
+end for
+put "should be 0: ", bad
+
+for i : 1 .. 3000
+    IntIntMap.Free (ids (i))
+end for
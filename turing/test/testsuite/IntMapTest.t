@@ -0,0 +1,33 @@
+% Counts with an IntIntMap and dedups with an IntSet
+var m := IntIntMap.New
+var s := IntSet.New
+IntIntMap.Reserve (m, 1000)
+for i : 1 .. 5000
+    var k := (i * 7919) mod 1000 - 500
+    var n : int
+    if IntIntMap.Get (m, k, n) then
+	IntIntMap.Put (m, k, n + 1)
+    else
+	IntIntMap.Put (m, k, 1)
+    end if
+    IntSet.Add (s, k mod 10)
+end for
+put IntIntMap.Size (m), " ", IntSet.Size (s)
+
+var n : int
+put IntIntMap.Get (m, -500, n), " ", n
+put IntIntMap.Get (m, 500, n), " ", n
+
+for k : -500 .. 499 by 2
+    IntIntMap.Remove (m, k)
+end for
+put IntIntMap.Size (m), " ", IntIntMap.Contains (m, -500), " ",
+    IntIntMap.Contains (m, -499)
+
+IntSet.Remove (s, 0)
+put IntSet.Contains (s, 0), " ", IntSet.Contains (s, -9)
+IntSet.Clear (s)
+put IntSet.Size (s)
+
+IntSet.Free (s)
+IntIntMap.Free (m)
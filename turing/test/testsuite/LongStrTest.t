@@ -0,0 +1,16 @@
+% Builds, searches and prints a string longer than 255 characters
+var s := LongStr.New
+for i : 1 .. 1000
+    LongStr.Append (s, "abc")
+end for
+LongStr.Append (s, "xyz")
+put LongStr.Length (s), " ", LongStr.Index (s, "cxy", 1)
+put LongStr.Sub (s, 2998, 3003)
+
+var t := LongStr.SubLong (s, 1, 3000)
+put LongStr.Compare (s, t) > 0, " ", LongStr.Compare (t, t) = 0
+LongStr.AppendLong (t, t)
+put LongStr.Length (t)
+
+LongStr.Free (t)
+LongStr.Free (s)
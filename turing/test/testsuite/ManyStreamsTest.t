@@ -0,0 +1,29 @@
+% Opens more streams at once than the old limit of 20, writes to each in
+% turn, then reads them all back
+const count := 200
+var streams : array 1 .. count of int
+for i : 1 .. count
+    open : streams (i), "stream" + intstr (i) + ".txt", put
+    assert streams (i) > 0
+end for
+for line : 1 .. 3
+    for i : 1 .. count
+	put : streams (i), i * line
+    end for
+end for
+for i : 1 .. count
+    close : streams (i)
+end for
+
+var total, n : int := 0
+for i : 1 .. count
+    open : streams (i), "stream" + intstr (i) + ".txt", get
+end for
+for i : 1 .. count
+    for line : 1 .. 3
+	get : streams (i), n
+	total += n
+    end for
+    close : streams (i)
+end for
+put total, " ", 6 * count * (count + 1) div 2
@@ -0,0 +1,17 @@
+% Prints a sweep of int, nat and real conversions.  The output must match
+% testout/NumFormatTest.txt, from the original formatting code, byte for
+% byte.
+var x : real := 1.0
+for i : 1 .. 40
+    put realstr (x, 0), " ", realstr (-x, 12), " ", realstr (1 / x, 0)
+    put frealstr (x, 0, 3), " ", frealstr (-x / 7, 14, 6), " ", frealstr (1 / x, 0, 9)
+    put erealstr (x, 0, 6, 2), " ", erealstr (-1 / x, 16, 3, 3)
+    x := x * 3.7
+end for
+for i : 1 .. 40
+    const v := (i * 104729 * i) mod 1000003 - 500001
+    put v, " ", v : 12, " ", intstr (v, 0, 16), " ", intstr (v * 4093, 14)
+    put natstr (i * 65537 * i, 0), " ", natstr (i * 97, 8, 2)
+end for
+put minint, " ", maxint, " ", maxnat
+put 0.0005, " ", 0.001, " ", 999999.9999, " ", 1000000.0, " ", 0.0
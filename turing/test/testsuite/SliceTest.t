@@ -0,0 +1,33 @@
+% Runs two busy processes under each time slice policy and checks that
+% both of them get turns
+const policies : array 1 .. 3 of int := init (Concurrency.sliceRandom,
+    Concurrency.sliceInstructions,
+    Concurrency.sliceMilliseconds + Concurrency.sliceSkipAlone)
+var turns : array 1 .. 2 of int
+var done : array 1 .. 2 of boolean
+
+process Busy (who : int)
+    var last := -1
+    for i : 1 .. 100000
+	if Concurrency.Switches not= last then
+	    last := Concurrency.Switches
+	    turns (who) += 1
+	end if
+    end for
+    done (who) := true
+end Busy
+
+for p : 1 .. 3
+    Concurrency.SetSlice (policies (p), 5)
+    turns (1) := 0
+    turns (2) := 0
+    done (1) := false
+    done (2) := false
+    fork Busy (1)
+    fork Busy (2)
+    loop
+	exit when done (1) and done (2)
+    end loop
+    put "policy ", policies (p), ": ", turns (1) > 1, " ", turns (2) > 1
+end for
+put "switches: ", Concurrency.TotalSwitches > 0
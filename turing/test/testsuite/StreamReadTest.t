@@ -0,0 +1,35 @@
+% Writes a file, then reads it back with Stream.ReadLines, Stream.GetInts,
+% Stream.GetReals and Stream.ReadAll, then puts a grid with Stream.Write
+var f : int
+open : f, "streamread.txt", put
+put : f, "first line"
+put : f, "second line"
+for i : 1 .. 2000
+    put : f, i * 7 - 300, " " ..
+end for
+put : f, ""
+put : f, "1.5 -2.25e3  7"
+put : f, "tail"
+close : f
+
+var lines : array 1 .. 5 of string
+var ints : array 1 .. 2000 of int
+var reals : array 1 .. 3 of real
+var chars : array 1 .. 100 of char
+open : f, "streamread.txt", get
+put Stream.ReadLines (f, lines, 2), " ", lines (1), "/", lines (2)
+put Stream.GetInts (f, ints, 2000), " ", ints (1), " ", ints (2000)
+put Stream.GetReals (f, reals, 3), " ", reals (1), " ", reals (2), " ", reals (3)
+const n := Stream.ReadAll (f, chars)
+put n, " ", chars (1), chars (2), chars (3), chars (4)
+put Stream.GetInts (f, ints, 2000)
+close : f
+
+var row : char (40)
+for y : 1 .. 5
+    for x : 1 .. 40
+	row (x) := chr (ord ("a") + (x * y) mod 26)
+    end for
+    Stream.Write (-1, row, 40 - y)
+    put ""
+end for
@@ -0,0 +1,59 @@
+% Times index, comparison and token reads on 255 character strings
+% The get section reads whitespace separated tokens from standard input
+% until eof, e.g. run with 255 character lines of words and runs of
+% spaces redirected in, with no token longer than 255 characters
+const iterations := 200000
+
+var hay : string := repeat ("x", 254) + "y"
+var other : string := repeat ("x", 253) + "xy"
+var hits : int := 0
+
+var start := Time.Elapsed
+for i : 1 .. iterations
+    hits += index (hay, "xy")
+end for
+put "index:   ", Time.Elapsed - start, " ms (", hits, ")"
+
+hits := 0
+start := Time.Elapsed
+for i : 1 .. iterations
+    if hay = other then
+	hits += 1
+    end if
+    if hay < other then
+	hits += 1
+    end if
+end for
+put "compare: ", Time.Elapsed - start, " ms (", hits, ")"
+
+var words : string := ""
+loop
+    exit when length (words) + 8 > 255
+    words += "token   "
+end loop
+hits := 0
+start := Time.Elapsed
+for i : 1 .. iterations div 100
+    var pos : int := 1
+    loop
+	var at := index (words (pos .. *), " ")
+	exit when at = 0
+	hits += 1
+	pos += at
+	exit when pos > length (words)
+    end loop
+end for
+put "scan:    ", Time.Elapsed - start, " ms (", hits, ")"
+
+var chars : int := 0
+hits := 0
+start := Time.Elapsed
+loop
+    get skip
+    exit when eof
+    var token : string
+    get token
+    hits += 1
+    chars += length (token)
+end loop
+put "get:     ", Time.Elapsed - start, " ms (", hits, " tokens, ", chars, " chars)"
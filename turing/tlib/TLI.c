@@ -166,10 +166,10 @@ typedef	TLchar	TL_TLI___x573[16];
 typedef	TL_TLI___x573	TL_TLI___x572[3];
 static TL_TLI___x572	TL_TLI_StreamName = 
     {"Standard Input", "Standard Output", "Standard Error"};
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x574[33];
-TL_TLI___x574	TL_TLI_TLIS;
-TLboolean	TL_TLI_TLIUXS;
-TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x574[TL_TLI_MAXSTREAM + 3];
+TLVMSTATE TL_TLI___x574	TL_TLI_TLIS;
+TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -286,7 +286,7 @@ void TL_TLI () {
     TL_TLI_TLIUXS = 0;
     {
 	register TLint4	sn;
-	for (sn = -2; sn <= 30; sn++) {
+	for (sn = -2; sn <= TL_TLI_MAXSTREAM; sn++) {
 	    TL_TLI_TLIS[sn - -2].mode = 0x0;
 	    TL_TLI_TLIS[sn - -2].waitingForInput = (struct TL_TL_ProcessDescriptor *) 0;
 	};
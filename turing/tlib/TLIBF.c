@@ -0,0 +1,667 @@
+#include "include/cinterface"
+#include <stdio.h>
+#include <float.h>
+#include <errno.h>
+#ifdef _WIN32
+#include <io.h>
+#define read	_read
+#else
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#define TLIBF_MMAP
+#define TLIBF_READV
+#ifdef __linux__
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#define TLIBF_PREFETCH
+#endif
+#endif
+
+/*
+ * Block buffered standard input.
+ *
+ * Installed in place of fgetc, ungetc and fread (TL_TLI_TLIFGC,
+ * TL_TLI_TLIFUG and TL_TLI_TLIFRE), these read standard input with
+ * large read(2) calls into one buffer instead of taking the stdio lock
+ * once per character.  Every other stream is passed through to stdio.
+ *
+ *	TL_TLI_TLIBFG (file)		fgetc
+ *	TL_TLI_TLIBFU (ch, file)	ungetc
+ *	TL_TLI_TLIBFR (ptr, size, count, file)
+ *					fread
+ *	TL_TLI_TLIBFW (file, &start)	the unread bytes of the buffer, read
+ *					in more if it is empty; returns how
+ *					many (0 at end of file), or -1 if the
+ *					file is not buffered here
+ *	TL_TLI_TLIBFA (count)		consume count bytes of that window
+ *	TL_TLI_TLIBFM ()		map standard input into memory if it
+ *					is a regular file
+ *	TL_TLI_TLIBFT ()		start a thread reading standard input
+ *					ahead if it is a pipe; returns 1 if
+ *					it did
+ *	TL_TLI_TLIBFI (file, &atEof, &value, isNat)
+ *	TL_TLI_TLIBFD (file, &atEof, &value)
+ *					read an int, nat or real straight
+ *					out of the buffer; returns 0, having
+ *					consumed at most leading white space,
+ *					when the caller must go the long way
+ *
+ * TLIBFW and TLIBFA let the token and line readers scan the buffer
+ * directly.  TLIBFI and TLIBFD do what TLIGT followed by TLAVSI, TLAVSN
+ * or TLAVS8 would for the common, well formed case: the token is decimal,
+ * lies wholly in the buffer and cannot overflow.  Anything else is left
+ * to TLIGI, TLIGN and TLIGR, so every error message comes from the same
+ * place it always did.  The readers only use them while TL_TLI_TLIFGC is TLIBFG,
+ * so an environment that installs its own character routines is not
+ * bypassed.
+ *
+ * The byte before the unread ones is always free, so one character can
+ * be pushed back after any read, which is all ungetc promises.  End of
+ * file is not sticky: a read that returns nothing is reported as end of
+ * file, and the next call tries again, so a terminal can go on after a
+ * ^D once TLIEFR has reset the stream.  So a reader must use the count
+ * its first TLIBFW returns, not call it once to test for buffering and
+ * again for the bytes, or an empty read from a terminal would be lost.
+ *
+ * When standard input is redirected from a regular file, TLIBFM maps the
+ * whole of it and the mapping becomes the buffer, so input is never
+ * copied at all.  It has to be called before the run is sandboxed, since
+ * the seccomp rules only allow anonymous mappings.  End of file is then
+ * the end of the mapping, so a file that grows afterwards is not seen.
+ * Pipes, terminals and Windows keep using read(2) into the block buffer.
+ *
+ * On Linux, TLIBFT can instead hand a pipe to a thread that reads it
+ * into a ring of blocks while the program runs, so waiting on the
+ * writer overlaps with execution.  The reader owns the blocks from head
+ * up to tail and the program owns the one it is reading, and the two
+ * only wait (on a futex) when the ring is full or empty.  The program
+ * sees exactly the bytes it would have read itself, only sooner, and
+ * output is still written out before it waits for input.  A terminal is left alone, since
+ * reading ahead of a prompt would swallow input meant for something
+ * else.  The thread is started before the run is sandboxed, and then
+ * needs only read and futex.
+ */
+
+#define TLIBF_SIZE	65536
+
+#define TLIBF_ISBLANK(c)	(((c) == ' ') || ((c) == '\t') || ((c) == '\f'))
+
+/* Eight digits at a time needs unaligned little endian loads */
+#if (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) \
+	|| defined(_M_IX86) || defined(_M_X64)
+#define TLIBF_SWAR
+#endif
+
+/* Exact double arithmetic (no x87 excess precision) for reals */
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+#define TLIBF_EXACT
+#endif
+
+extern TLint4 	(*TL_TLI_TLIFGC)();
+extern void TL_TLQUIT ();
+
+static char	TLIBFblock[TLIBF_SIZE + 1];
+static char	*TLIBFbuf = TLIBFblock;
+static TLint4	TLIBFpos = 1;
+static TLint4	TLIBFend = 1;
+static TLboolean	TLIBFmapped = 0;
+
+#ifdef TLIBF_PREFETCH
+#define TLIBF_SLOTS	8
+
+struct TLIBFslot {
+    TLint4	len;
+    char	data[TLIBF_SIZE + 1];
+};
+
+static struct TLIBFslot	TLIBFring[TLIBF_SLOTS];
+/* Slots filled by the reader and slots given back by the program */
+static unsigned int	TLIBFhead = 0;
+static unsigned int	TLIBFtail = 0;
+static int	TLIBFheadWait = 0;
+static int	TLIBFtailWait = 0;
+static TLboolean	TLIBFprefetching = 0;
+static TLboolean	TLIBFholding = 0;
+
+#define TLIBF_LOAD(x)		__atomic_load_n(&(x), __ATOMIC_SEQ_CST)
+#define TLIBF_STORE(x, v)	__atomic_store_n(&(x), (v), __ATOMIC_SEQ_CST)
+
+/* Sleep while counter is still value; wake anyone sleeping on it */
+static void TLIBFwait (counter, value, waiting)
+unsigned int	*counter;
+unsigned int	value;
+int	*waiting;
+{
+    TLIBF_STORE(*waiting, 1);
+    if (TLIBF_LOAD(*counter) == value) {
+	syscall(SYS_futex, counter, FUTEX_WAIT_PRIVATE, value, (void *) 0, (void *) 0, 0);
+    };
+}
+
+static void TLIBFpost (counter, value, waiting)
+unsigned int	*counter;
+unsigned int	value;
+int	*waiting;
+{
+    TLIBF_STORE(*counter, value);
+    if (TLIBF_LOAD(*waiting)) {
+	TLIBF_STORE(*waiting, 0);
+	syscall(SYS_futex, counter, FUTEX_WAKE_PRIVATE, 1, (void *) 0, (void *) 0, 0);
+    };
+}
+
+static void *TLIBFreader (arg)
+void	*arg;
+{
+    register struct TLIBFslot	*slot;
+    register TLint4	n;
+    unsigned int	head;
+    head = 0;
+    for(;;) {
+	while (head - TLIBF_LOAD(TLIBFtail) == TLIBF_SLOTS) {
+	    TLIBFwait(&TLIBFtail, head - TLIBF_SLOTS, &TLIBFtailWait);
+	};
+	slot = &TLIBFring[head % TLIBF_SLOTS];
+	do {
+	    n = read(fileno(stdin), slot->data + 1, TLIBF_SIZE);
+	} while ((n < 0) && (errno == EINTR));
+	slot->len = (n > 0) ? n : 0;
+	head += 1;
+	TLIBFpost(&TLIBFhead, head, &TLIBFheadWait);
+	if (n <= 0) {
+	    break;
+	};
+    };
+    /* A pipe stays at end of file, so sleep until the program exits */
+    for(;;) {
+	syscall(SYS_futex, &TLIBFhead, FUTEX_WAIT_PRIVATE, head, (void *) 0, (void *) 0, 0);
+    };
+    return ((void *) 0);
+}
+
+/* Give back the block just read and take the next one */
+static TLint4 TLIBFnext ()
+{
+    register struct TLIBFslot	*slot;
+    if (TLIBFholding) {
+	slot = &TLIBFring[TLIBFtail % TLIBF_SLOTS];
+	if (slot->len == 0) {
+	    return (0);
+	};
+	TLIBFpost(&TLIBFtail, TLIBFtail + 1, &TLIBFtailWait);
+    };
+    if (TLIBF_LOAD(TLIBFhead) == TLIBFtail) {
+	/* Let a prompt out before waiting for the answer */
+	TL_TLI_TLIBOX();
+	while (TLIBF_LOAD(TLIBFhead) == TLIBFtail) {
+	    TLIBFwait(&TLIBFhead, TLIBFtail, &TLIBFheadWait);
+	};
+    };
+    slot = &TLIBFring[TLIBFtail % TLIBF_SLOTS];
+    TLIBFholding = 1;
+    TLIBFbuf = slot->data;
+    TLIBFpos = 1;
+    TLIBFend = 1 + slot->len;
+    return (slot->len);
+}
+#endif
+
+static TLint4 TLIBFfill ()
+{
+    register TLint4	n;
+    if (TLIBFmapped) {
+	return (0);
+    };
+#ifdef TLIBF_PREFETCH
+    if (TLIBFprefetching) {
+	return (TLIBFnext());
+    };
+#endif
+    /* Let a prompt out before waiting for the answer */
+    TL_TLI_TLIBOX();
+    do {
+	n = read(fileno(stdin), TLIBFbuf + 1, TLIBF_SIZE);
+    } while ((n < 0) && (errno == EINTR));
+    TLIBFpos = 1;
+    if (n <= 0) {
+	TLIBFend = 1;
+	return (0);
+    };
+    TLIBFend = 1 + n;
+    return (n);
+}
+
+TLint4 TL_TLI_TLIBFG (file)
+TLaddressint	file;
+{
+    if (file != (TLaddressint) stdin) {
+	return (fgetc((FILE *) file));
+    };
+    if ((TLIBFpos >= TLIBFend) && (TLIBFfill() == 0)) {
+	return (-1);
+    };
+    return ((TLnat1) TLIBFbuf[TLIBFpos++]);
+}
+
+void TL_TLI_TLIBFU (ch, file)
+TLint4	ch;
+TLaddressint	file;
+{
+    if (file != (TLaddressint) stdin) {
+	ungetc(ch, (FILE *) file);
+	return;
+    };
+    if ((ch != -1) && (TLIBFpos > 0)) {
+	TLIBFbuf[--TLIBFpos] = (char) ch;
+    };
+}
+
+TLint4 TL_TLI_TLIBFR (ptr, size, count, file)
+TLaddressint	ptr;
+TLint4	size;
+TLint4	count;
+TLaddressint	file;
+{
+    register TLint4	want, have, n;
+#ifdef TLIBF_READV
+    struct iovec	iov[2];
+#endif
+    if ((file != (TLaddressint) stdin) || (size <= 0)) {
+	return (fread(ptr, size, count, (FILE *) file));
+    };
+    want = size * count;
+    have = TLIBFend - TLIBFpos;
+    if (have > want) {
+	have = want;
+    };
+    memcpy(ptr, TLIBFbuf + TLIBFpos, have);
+    TLIBFpos += have;
+    if ((have == want) || TLIBFmapped) {
+	return (have / size);
+    };
+#ifdef TLIBF_PREFETCH
+    if (TLIBFprefetching) {
+	while ((have < want) && (TLIBFnext() > 0)) {
+	    n = TLIBFend - TLIBFpos;
+	    if (n > want - have) {
+		n = want - have;
+	    };
+	    memcpy(ptr + have, TLIBFbuf + TLIBFpos, n);
+	    TLIBFpos += n;
+	    have += n;
+	};
+	return (have / size);
+    };
+#endif
+    /*
+     * The rest goes straight into the caller's memory, and the same
+     * readv refills the (now empty) buffer, so a run of small binary
+     * reads costs one system call per buffer full rather than one each.
+     * Without readv, small reads go through the buffer and large ones
+     * straight to the caller.
+     */
+    TL_TLI_TLIBOX();
+    while (have < want) {
+#ifdef TLIBF_READV
+	iov[0].iov_base = ptr + have;
+	iov[0].iov_len = want - have;
+	iov[1].iov_base = TLIBFblock + 1;
+	iov[1].iov_len = TLIBF_SIZE;
+	n = readv(fileno(stdin), iov, 2);
+#else
+	if (want - have < TLIBF_SIZE) {
+	    if (TLIBFfill() == 0) {
+		break;
+	    };
+	    n = TLIBFend - TLIBFpos;
+	    if (n > want - have) {
+		n = want - have;
+	    };
+	    memcpy(ptr + have, TLIBFbuf + TLIBFpos, n);
+	    TLIBFpos += n;
+	    have += n;
+	    continue;
+	};
+	n = read(fileno(stdin), ptr + have, want - have);
+#endif
+	if (n < 0 && errno == EINTR) {
+	    continue;
+	};
+	if (n <= 0) {
+	    break;
+	};
+	if (n > want - have) {
+	    TLIBFpos = 1;
+	    TLIBFend = 1 + n - (want - have);
+	    have = want;
+	} else {
+	    have += n;
+	};
+    };
+    return (have / size);
+}
+
+TLint4 TL_TLI_TLIBFW (file, start)
+TLaddressint	file;
+TLaddressint	*start;
+{
+    if ((file != (TLaddressint) stdin) || (TL_TLI_TLIFGC != TL_TLI_TLIBFG)) {
+	return (-1);
+    };
+    if (TLIBFpos >= TLIBFend) {
+	TLIBFfill();
+    };
+    (*start) = TLIBFbuf + TLIBFpos;
+    return (TLIBFend - TLIBFpos);
+}
+
+void TL_TLI_TLIBFA (count)
+TLint4	count;
+{
+    TLIBFpos += count;
+}
+
+void TL_TLI_TLIBFM ()
+{
+#ifdef TLIBF_MMAP
+    struct stat	info;
+    off_t	offset;
+    char	*map;
+    if ((TLIBFmapped) || (TLIBFpos < TLIBFend) ||
+	    (fstat(fileno(stdin), &info) != 0) || !S_ISREG(info.st_mode) ||
+	    (info.st_size <= 0) || (info.st_size >= 0x7FFFFFFF)) {
+	return;
+    };
+    offset = lseek(fileno(stdin), (off_t) 0, SEEK_CUR);
+    if ((offset < 0) || (offset >= info.st_size)) {
+	return;
+    };
+    /*
+     * Private and writable so that a pushed back character can always be
+     * stored; only the page it lands on is ever copied.
+     */
+    map = mmap((void *) 0, (size_t) info.st_size, PROT_READ | PROT_WRITE,
+	MAP_PRIVATE, fileno(stdin), (off_t) 0);
+    if (map == (char *) MAP_FAILED) {
+	return;
+    };
+#ifdef MADV_SEQUENTIAL
+    madvise(map, (size_t) info.st_size, MADV_SEQUENTIAL);
+#endif
+    TLIBFbuf = map;
+    TLIBFpos = (TLint4) offset;
+    TLIBFend = (TLint4) info.st_size;
+    TLIBFmapped = 1;
+#endif
+}
+
+TLint4 TL_TLI_TLIBFT ()
+{
+#ifdef TLIBF_PREFETCH
+    struct stat	info;
+    pthread_t	thread;
+    pthread_attr_t	attr;
+    TLint4	started;
+    if ((TLIBFmapped) || (TLIBFprefetching) || (TLIBFpos < TLIBFend) ||
+	    isatty(fileno(stdin)) || (fstat(fileno(stdin), &info) != 0) ||
+	    S_ISREG(info.st_mode)) {
+	return (0);
+    };
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_attr_setstacksize(&attr, (size_t) 65536);
+    started = (pthread_create(&thread, &attr, TLIBFreader, (void *) 0) == 0);
+    pthread_attr_destroy(&attr);
+    TLIBFprefetching = started;
+    return (started);
+#else
+    return (0);
+#endif
+}
+
+/*
+ * Skip white space and find the next token.  Returns its length, or -1
+ * if the token runs to the end of the buffered bytes (it may go on) or
+ * the stream is not buffered here.
+ */
+static TLint4 TLIBFtoken (file, atEof, start)
+TLaddressint	file;
+TLboolean	*atEof;
+TLaddressint	*start;
+{
+    register TLint4	n, len;
+    if ((file != (TLaddressint) stdin) || (TL_TLI_TLIFGC != TL_TLI_TLIBFG) || (*atEof)) {
+	return (-1);
+    };
+    for(;;) {
+	if ((TLIBFpos >= TLIBFend) && (TLIBFfill() == 0)) {
+	    (*atEof) = 1;
+	    TL_TLQUIT("Attempt to read past eof", (TLint4) 80);
+	};
+	n = TL_TLS_TLSVSK(TLIBFbuf + TLIBFpos, TLIBFend - TLIBFpos);
+	TLIBFpos += n;
+	if (TLIBFpos < TLIBFend) {
+	    break;
+	};
+    };
+    len = TL_TLS_TLSVTK(TLIBFbuf + TLIBFpos, TLIBFend - TLIBFpos);
+    if ((TLIBFpos + len >= TLIBFend) || (len > 255)) {
+	return (-1);
+    };
+    (*start) = TLIBFbuf + TLIBFpos;
+    return (len);
+}
+
+/*
+ * Consume a token of len bytes and, as TLIGT does, the blanks after it
+ * up to and including the end of the line.
+ */
+static void TLIBFskip (len, atEof)
+TLint4	len;
+TLboolean	*atEof;
+{
+    register TLint4	ch;
+    TLIBFpos += len;
+    ch = (TLnat1) TLIBFbuf[TLIBFpos++];
+    if (ch != '\n') {
+	for(;;) {
+	    ch = TL_TLI_TLIBFG((TLaddressint) stdin);
+	    if (ch == -1) {
+		(*atEof) = 1;
+		return;
+	    };
+	    if (!TLIBF_ISBLANK(ch)) {
+		break;
+	    };
+	};
+	if (ch != '\n') {
+	    TL_TLI_TLIBFU(ch, (TLaddressint) stdin);
+	};
+    };
+}
+
+/*
+ * Value of the decimal digits in [p, end), at most 19 of them, or -1 if
+ * there is anything else.
+ */
+static int64_t TLIBFdigits (p, end)
+register TLaddressint	p;
+register TLaddressint	end;
+{
+    register uint64_t	value = 0;
+    register TLnat4	d;
+#ifdef TLIBF_SWAR
+    uint64_t	chunk;
+    while (end - p >= 8) {
+	memcpy(&chunk, p, 8);
+	/* Every byte in '0' .. '9' */
+	if ((((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+		(((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4))
+		!= 0x3333333333333333ULL)) {
+	    return (-1);
+	};
+	chunk -= 0x3030303030303030ULL;
+	chunk = (chunk * 10) + (chunk >> 8);
+	chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+		 (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+	value = value * 100000000 + chunk;
+	p += 8;
+    };
+#endif
+    while (p < end) {
+	d = (TLnat1) (*p++) - '0';
+	if (d > 9) {
+	    return (-1);
+	};
+	value = value * 10 + d;
+    };
+    return ((int64_t) value);
+}
+
+TLboolean TL_TLI_TLIBFI (file, atEof, value, isNat)
+TLaddressint	file;
+TLboolean	*atEof;
+TLnat4	*value;
+TLboolean	isNat;
+{
+    TLaddressint	start, p, end;
+    register TLint4	len;
+    TLboolean	isNegative;
+    int64_t	magnitude;
+    len = TLIBFtoken(file, atEof, &start);
+    if (len < 0) {
+	return (0);
+    };
+    p = start;
+    end = start + len;
+    isNegative = 0;
+    if ((*p == '-') && !isNat) {
+	isNegative = 1;
+	p += 1;
+    } else if (*p == '+') {
+	p += 1;
+    };
+    if (p == end) {
+	return (0);
+    };
+    while ((p < end) && (*p == '0')) {
+	p += 1;
+    };
+    if (end - p > 10) {
+	return (0);
+    };
+    magnitude = TLIBFdigits(p, end);
+    if ((magnitude < 0) || (magnitude > (isNat ? 0xFFFFFFFFLL : 0x7FFFFFFFLL))) {
+	return (0);
+    };
+    if (isNegative) {
+	(*value) = (TLnat4) (- (TLint4) magnitude);
+    } else {
+	(*value) = (TLnat4) magnitude;
+    };
+    TLIBFskip(len, atEof);
+    return (1);
+}
+
+#ifdef TLIBF_EXACT
+static TLreal8	TLIBFpower10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#endif
+
+TLboolean TL_TLI_TLIBFD (file, atEof, value)
+TLaddressint	file;
+TLboolean	*atEof;
+TLreal8	*value;
+{
+#ifdef TLIBF_EXACT
+    TLaddressint	start, p, end;
+    register TLint4	len, significant, scale, exponent;
+    TLboolean	isNegative, exponentNegative, sawDigit;
+    int64_t	mantissa;
+    TLreal8	result;
+    len = TLIBFtoken(file, atEof, &start);
+    if (len < 0) {
+	return (0);
+    };
+    p = start;
+    end = start + len;
+    isNegative = (*p == '-');
+    if ((*p == '-') || (*p == '+')) {
+	p += 1;
+    };
+    /*
+     * With at most 15 significant digits and a power of ten no larger
+     * than 1e22 both operands are exact, so one multiply or divide gives
+     * the correctly rounded result atof would.
+     */
+    mantissa = 0;
+    significant = 0;
+    scale = 0;
+    sawDigit = 0;
+    for (; (p < end) && (*p >= '0') && (*p <= '9'); p++) {
+	sawDigit = 1;
+	if ((mantissa != 0) || (*p != '0')) {
+	    if (++significant > 15) {
+		return (0);
+	    };
+	    mantissa = mantissa * 10 + (*p - '0');
+	};
+    };
+    if ((p < end) && (*p == '.')) {
+	for (p++; (p < end) && (*p >= '0') && (*p <= '9'); p++) {
+	    sawDigit = 1;
+	    scale += 1;
+	    if ((mantissa != 0) || (*p != '0')) {
+		if (++significant > 15) {
+		    return (0);
+		};
+		mantissa = mantissa * 10 + (*p - '0');
+	    };
+	};
+    };
+    if (!sawDigit) {
+	return (0);
+    };
+    exponent = 0;
+    if ((p < end) && ((*p == 'e') || (*p == 'E'))) {
+	p += 1;
+	exponentNegative = (p < end) && (*p == '-');
+	if ((p < end) && ((*p == '-') || (*p == '+'))) {
+	    p += 1;
+	};
+	if ((p == end) || (end - p > 3)) {
+	    return (0);
+	};
+	for (; (p < end) && (*p >= '0') && (*p <= '9'); p++) {
+	    exponent = exponent * 10 + (*p - '0');
+	};
+	if (exponentNegative) {
+	    exponent = - exponent;
+	};
+    };
+    if (p != end) {
+	return (0);
+    };
+    exponent -= scale;
+    if ((exponent < -22) || (exponent > 22)) {
+	return (0);
+    };
+    result = (TLreal8) mantissa;
+    if (exponent >= 0) {
+	result *= TLIBFpower10[exponent];
+    } else {
+	result /= TLIBFpower10[- exponent];
+    };
+    (*value) = isNegative ? - result : result;
+    TLIBFskip(len, atEof);
+    return (1);
+#else
+    return (0);
+#endif
+}
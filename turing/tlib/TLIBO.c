@@ -0,0 +1,259 @@
+#include "include/cinterface"
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#ifdef _WIN32
+#include <io.h>
+#define write	_write
+#else
+#include <unistd.h>
+#include <sys/uio.h>
+#define TLIBO_WRITEV
+#endif
+
+/*
+ * Block buffered standard output.
+ *
+ * Installed in place of fputs, fputc, fwrite and fflush (TL_TLI_TLIFPS,
+ * TL_TLI_TLIFPC, TL_TLI_TLIFWR and TL_TLI_TLIFFL), these collect
+ * everything put to standard output in one buffer and hand it to the
+ * system with large write(2) calls.  Every other stream is passed
+ * through to stdio.
+ *
+ *	TL_TLI_TLIBOS (str, file)	fputs
+ *	TL_TLI_TLIBOC (ch, file)	fputc
+ *	TL_TLI_TLIBOW (ptr, size, count, file)
+ *					fwrite
+ *	TL_TLI_TLIBOF (file)		fflush
+ *	TL_TLI_TLIBOX ()		write out whatever is buffered
+ *	TL_TLI_TLIBOB (count, ch, file)	put count copies of ch (field padding)
+ *	TL_TLI_TLIBOI (file, value, width, isNat)
+ *					put an int or nat right justified in
+ *					width, formatted straight into the
+ *					buffer; returns 0 if file is not
+ *					buffered here
+ *
+ * The buffer is written out when it fills, whenever the stream is
+ * flushed (TLIFS, which the executor calls when it stops, on abort and
+ * for Stream.FlushAll), before anything goes to standard error, before
+ * standard input is read (see TLIBF) and at exit.  Large items are not
+ * copied: they go out in the same writev as what is already buffered.
+ */
+
+#define TLIBO_SIZE	65536
+
+/* Items at least this big are not copied into the buffer */
+#ifdef TLIBO_WRITEV
+#define TLIBO_DIRECT	(TLIBO_SIZE / 4)
+#else
+#define TLIBO_DIRECT	(TLIBO_SIZE + 1)
+#endif
+
+#define TLIBO_ISSTDOUT(file)	(((file) == (TLaddressint) stdout) && \
+				 (TL_TLI_TLIFPS == TL_TLI_TLIBOS))
+
+extern void 	(*TL_TLI_TLIFPS)();
+
+static char	TLIBObuf[TLIBO_SIZE];
+static TLint4	TLIBOlen = 0;
+static TLboolean	TLIBOregistered = 0;
+
+static void TLIBOwrite (ptr, len)
+char	*ptr;
+TLint4	len;
+{
+    register TLint4	n;
+    while (len > 0) {
+	n = write(fileno(stdout), ptr, len);
+	if (n < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    };
+	    /* Nowhere to put it, as with fputs on a closed stdout */
+	    return;
+	};
+	ptr += n;
+	len -= n;
+    };
+}
+
+void TL_TLI_TLIBOX ()
+{
+    if (TLIBOlen > 0) {
+	TLIBOwrite(TLIBObuf, TLIBOlen);
+	TLIBOlen = 0;
+    };
+}
+
+/* Make room for len bytes, and see that the buffer is written at exit */
+static void TLIBOroom (len)
+TLint4	len;
+{
+    if (!TLIBOregistered) {
+	TLIBOregistered = 1;
+	atexit(TL_TLI_TLIBOX);
+    };
+    if (TLIBOlen + len > TLIBO_SIZE) {
+	TL_TLI_TLIBOX();
+    };
+}
+
+/* Write out the buffer followed by len bytes at ptr */
+static void TLIBOflushWith (ptr, len)
+char	*ptr;
+TLint4	len;
+{
+#ifdef TLIBO_WRITEV
+    struct iovec	iov[2];
+    register TLint4	n;
+    iov[0].iov_base = TLIBObuf;
+    iov[0].iov_len = TLIBOlen;
+    iov[1].iov_base = ptr;
+    iov[1].iov_len = len;
+    while (iov[0].iov_len > 0) {
+	n = writev(fileno(stdout), iov, 2);
+	if (n < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    };
+	    TLIBOlen = 0;
+	    return;
+	};
+	if ((size_t) n < iov[0].iov_len) {
+	    iov[0].iov_base = (char *) iov[0].iov_base + n;
+	    iov[0].iov_len -= n;
+	} else {
+	    n -= iov[0].iov_len;
+	    iov[0].iov_len = 0;
+	    ptr += n;
+	    len -= n;
+	};
+    };
+    TLIBOlen = 0;
+#else
+    TL_TLI_TLIBOX();
+#endif
+    TLIBOwrite(ptr, len);
+}
+
+static void TLIBOappend (ptr, len)
+char	*ptr;
+TLint4	len;
+{
+    if (len >= TLIBO_DIRECT) {
+	TLIBOroom(0);
+	TLIBOflushWith(ptr, len);
+	return;
+    };
+    TLIBOroom(len);
+    memcpy(TLIBObuf + TLIBOlen, ptr, len);
+    TLIBOlen += len;
+}
+
+void TL_TLI_TLIBOS (str, file)
+char	*str;
+TLaddressint	file;
+{
+    if (file == (TLaddressint) stdout) {
+	TLIBOappend(str, strlen(str));
+	return;
+    };
+    if (file == (TLaddressint) stderr) {
+	TL_TLI_TLIBOX();
+    };
+    fputs(str, (FILE *) file);
+}
+
+void TL_TLI_TLIBOC (ch, file)
+TLint4	ch;
+TLaddressint	file;
+{
+    if (file == (TLaddressint) stdout) {
+	TLIBOroom(1);
+	TLIBObuf[TLIBOlen++] = (char) ch;
+	return;
+    };
+    if (file == (TLaddressint) stderr) {
+	TL_TLI_TLIBOX();
+    };
+    fputc(ch, (FILE *) file);
+}
+
+TLint4 TL_TLI_TLIBOW (ptr, size, count, file)
+TLaddressint	ptr;
+TLint4	size;
+TLint4	count;
+TLaddressint	file;
+{
+    if (file == (TLaddressint) stdout) {
+	TLIBOappend(ptr, size * count);
+	return (count);
+    };
+    if (file == (TLaddressint) stderr) {
+	TL_TLI_TLIBOX();
+    };
+    return (fwrite(ptr, size, count, (FILE *) file));
+}
+
+void TL_TLI_TLIBOF (file)
+TLaddressint	file;
+{
+    if (file == (TLaddressint) stdout) {
+	TL_TLI_TLIBOX();
+    };
+    fflush((FILE *) file);
+}
+
+void TL_TLI_TLIBOB (count, ch, file)
+TLint4	count;
+TLint4	ch;
+TLaddressint	file;
+{
+    if (count <= 0) {
+	return;
+    };
+    if (TLIBO_ISSTDOUT(file)) {
+	TLIBOroom(count);
+	memset(TLIBObuf + TLIBOlen, ch, count);
+	TLIBOlen += count;
+	return;
+    };
+    {
+	TLstring	blanks;
+	memset(blanks, ch, count);
+	blanks[count] = '\0';
+	(*TL_TLI_TLIFPS)(blanks, file);
+    };
+}
+
+TLboolean TL_TLI_TLIBOI (file, value, width, isNat)
+TLaddressint	file;
+TLint4	value;
+TLint4	width;
+TLboolean	isNat;
+{
+    char	digits[12];
+    register char	*p;
+    register TLnat4	magnitude;
+    register TLint4	count;
+    TLboolean	isNegative;
+    if (!TLIBO_ISSTDOUT(file)) {
+	return (0);
+    };
+    isNegative = !isNat && (value < 0);
+    magnitude = isNegative ? - (TLnat4) value : (TLnat4) value;
+    p = digits + sizeof (digits);
+    p -= TL_TLS_TLSVDG(magnitude, p);
+    if (isNegative) {
+	*--p = '-';
+    };
+    count = (digits + sizeof (digits)) - p;
+    TLIBOroom((width > count) ? width : count);
+    if (width > count) {
+	memset(TLIBObuf + TLIBOlen, ' ', width - count);
+	TLIBOlen += width - count;
+    };
+    memcpy(TLIBObuf + TLIBOlen, p, count);
+    TLIBOlen += count;
+    return (1);
+}
@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x436[21];
 typedef	TL_TLI___x436	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x439[16];
 typedef	TL_TLI___x439	TL_TLI___x438[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x440[33];
-extern TL_TLI___x440	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x440[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x440	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -196,7 +196,7 @@ void TL_TLI_TLIEFR (streamNo)
 TLint4	streamNo;
 {
     TL_TLI_StreamModeSet	streamMode;
-    if ((streamNo < -2) || (streamNo > 30)) {
+    if ((streamNo < -2) || (streamNo > TL_TLI_MAXSTREAM)) {
 	{
 	    TLstring	__x447;
 	    TL_TLS_TLSVIS((TLint4) streamNo, (TLint4) 1, (TLint4) 10, __x447);
@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x442[21];
 typedef	TL_TLI___x442	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x445[16];
 typedef	TL_TLI___x445	TL_TLI___x444[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x446[33];
-extern TL_TLI___x446	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x446[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x446	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -200,7 +200,7 @@ TLint4	streamNo;
     if (!TL_TLI_TLIUXS) {
 	TL_TLI_TLIXSN = streamNo;
     };
-    if ((streamNo < -2) || (streamNo > 30)) {
+    if ((streamNo < -2) || (streamNo > TL_TLI_MAXSTREAM)) {
 	{
 	    TLstring	__x453;
 	    TL_TLS_TLSVIS((TLint4) TL_TLI_TLIXSN, (TLint4) 1, (TLint4) 10, __x453);
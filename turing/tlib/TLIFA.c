@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x444[21];
 typedef	TL_TLI___x444	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x447[16];
 typedef	TL_TLI___x447	TL_TLI___x446[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x448[33];
-extern TL_TLI___x448	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x448[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x448	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x443[21];
 typedef	TL_TLI___x443	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x446[16];
 typedef	TL_TLI___x446	TL_TLI___x445[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x447[33];
-extern TL_TLI___x447	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x447[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x447	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -195,7 +195,7 @@ extern void TL_TLI_TLIOS ();
 void TL_TLI_TLIFS () {
     {
 	register TLint4	streamNo;
-	for (streamNo = -2; streamNo <= 30; streamNo++) {
+	for (streamNo = -2; streamNo <= TL_TLI_MAXSTREAM; streamNo++) {
 	    TLBINDREG((*stream), struct TL_TLI_StreamEntryType);
 	    stream = &(TL_TLI_TLIS[streamNo - -2]);
 	    if ((((*stream).mode) & ((TLSMLSMLSETCONST(2) | TLSMLSMLSETCONST(4)))) != 0) {
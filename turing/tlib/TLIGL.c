@@ -0,0 +1,278 @@
+#include "include/cinterface"
+typedef	TLnat4	TL_TL_priority_t;
+struct	TL_TL_ExceptionInfo {
+    TLint4	quitCode;
+    TLint4	libraryQuitCode;
+    TLstring	errorMsg;
+};
+typedef	TLnat1	__x479[1];
+struct	TL_TL_HandlerArea {
+    TLint4	quitCode;
+    TLnat4	lineAndFile;
+    TLaddressint	fileTable;
+    struct TL_TL_HandlerArea	*nextHandler;
+    __x479	savedState;
+};
+typedef	TLnat4	TL_TL_hardwarePriority_t;
+typedef	TL_TL_hardwarePriority_t	TL_TL_lockStatus_t;
+typedef	TLnat4	TL_TL_lock_t;
+struct	TL_TL_link_t {
+    struct TL_TL_ProcessDescriptor	*flink;
+    struct TL_TL_ProcessDescriptor	*blink;
+};
+struct	TL_TL_ProcessDescriptor {
+    TLnat4	lineAndFile;
+    TLaddressint	fileTable;
+    TLaddressint	stackLimit;
+    TLaddressint	stackPointer;
+    struct TL_TL_HandlerArea	*handlerQhead;
+    struct TL_TL_HandlerArea	*currentHandler;
+    TLaddressint	name;
+    struct TL_TL_ExceptionInfo	exception;
+    TLnat4	waitParameter;
+    struct TL_TL_ProcessDescriptor	*monitorQlink;
+    TLnat4	timeOutStatus;
+    TLnat4	pid;
+    TLaddressint	memoryBase;
+    TLnat4	timeoutTime;
+    TLnat4	timeoutEpoch;
+    struct TL_TL_link_t	timeoutQ;
+    TLboolean	timedOut;
+    TLboolean	pausing;
+    TL_TL_priority_t	dispatchPriority;
+    struct TL_TL_ProcessDescriptor	*runQlink;
+    TLboolean	ready;
+    struct TL_TL_ProcessDescriptor	*tsyncWaiter;
+    TLnat4	quantum;
+    TLnat4	quantumCntr;
+    TLnat4	devmonLevel;
+    TLaddressint	otherInfo;
+};
+
+extern void TL_TLM_TLMUDUMP ();
+
+extern void TL_TLB_TLBMAL ();
+
+extern void TL_TLB_TLBMFR ();
+
+extern void TL_TLB_TLBNWU ();
+
+extern void TL_TLB_TLBFRU ();
+
+extern void TL_TLI_TLIFS ();
+
+extern void TL_TLI_TLIAON ();
+
+extern void TL_TLI_TLIAOFF ();
+
+extern void TL_TLI_TLIUDUMP ();
+
+extern void TL_TLI_TLIFINI ();
+
+extern void TL_TLE_TLELF ();
+typedef	TLint4	TL_Cint;
+extern TLboolean	TL_TLECU;
+extern struct TL_TL_ProcessDescriptor	*TL_TLKPD;
+
+void TL_TLQUIT ();
+
+extern void TL_TLK_TLKINI ();
+
+extern void TL_TLK_TLKFINI ();
+
+extern void TL_TLK_TLKUXRS ();
+
+extern void TL_TLK_TLKUXRE ();
+
+extern void TL_TLK_TLKUEXIT ();
+
+extern void TL_TLK_TLKUDMPP ();
+
+extern void TL_TLK_TLKPFORK ();
+
+extern TLboolean TL_TLK_TLKFRKED ();
+
+extern void TL_TLK_TLKLKON ();
+
+extern void TL_TLK_TLKLKOFF ();
+
+extern void TL_TLK_TLKSSYNC ();
+
+extern void TL_TLK_TLKSWAKE ();
+
+extern void TL_TLK_TLKSTIMO ();
+
+extern void TL_TLK_TLKCINI ();
+
+extern TLnat4 TL_TLK_TLKPGETP ();
+
+extern void TL_TLK_TLKPSETP ();
+
+extern void TL_TLK_TLKIPINI ();
+
+extern void TL_TLK_TLKIPENT ();
+
+extern void TL_TLK_TLKIPEXT ();
+
+extern TLboolean TL_TLK_TLKDMINI ();
+
+extern void TL_TLK_TLKDMENT ();
+
+extern void TL_TLK_TLKDMEXT ();
+
+extern void TL_TLK_TLKPPAUS ();
+
+extern void TL_TLX_TLXPID ();
+
+extern void TL_TLX_TLXTIM ();
+
+extern void TL_TLX_TLXATF ();
+
+extern void TL_TLX_TLXDT ();
+
+extern void TL_TLX_TLXTM ();
+
+extern void TL_TLX_TLXCL ();
+
+extern void TL_TLX_TLXSC ();
+
+extern void TL_TLX_TLXGE ();
+
+extern void TL_TLX_TLXSYS ();
+
+extern void TL_TLA_TLAVES ();
+
+extern void TL_TLA_TLAVFS ();
+
+extern void TL_TLA_TLAVS8 ();
+
+extern void TL_TLA_TLAVSI ();
+
+extern void TL_TLA_TLAVSN ();
+typedef	TLint4	TL_TLI_StreamNumberType;
+typedef	TLnat2	TL_TLI_StreamModeSet;
+struct	TL_TLI_StreamEntryType {
+    TLaddressint	fileName;
+    TLaddressint	info;
+    TL_Cint	lastOp;
+    TL_TLI_StreamModeSet	mode;
+    TLboolean	atEof;
+    struct TL_TL_ProcessDescriptor	*waitingForInput;
+};
+typedef	TLaddressint	TL_TLI___x482[21];
+typedef	TL_TLI___x482	TL_TLI_ArgList;
+typedef	TLchar	TL_TLI___x485[16];
+typedef	TL_TLI___x485	TL_TLI___x484[3];
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x486[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x486	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
+extern TLaddressint	TLIstdin;
+extern TLaddressint	TLIstdout;
+extern TLaddressint	TLIstderr;
+extern TLint4	TL_TLI_TLIARC;
+extern TLaddressint	TL_TLI_TLIARV;
+typedef	TLchar	TL_TLI___x490[42];
+extern TL_TLI___x490	TL_TLI_TLIPXL;
+typedef	TLchar	TL_TLI___x491[44];
+extern TL_TLI___x491	TL_TLI_TLIPXN;
+extern TLaddressint 	(*TL_TLI_TLIFOP)();
+extern void 	(*TL_TLI_TLIFFL)();
+extern void 	(*TL_TLI_TLIFCL)();
+extern TL_Cint 	(*TL_TLI_TLIFGC)();
+extern void 	(*TL_TLI_TLIFUG)();
+extern void 	(*TL_TLI_TLIFPC)();
+extern void 	(*TL_TLI_TLIFPS)();
+extern void 	(*TL_TLI_TLIFSK)();
+extern TLint4 	(*TL_TLI_TLIFTL)();
+extern TL_Cint 	(*TL_TLI_TLIFRE)();
+extern TL_Cint 	(*TL_TLI_TLIFWR)();
+extern void 	(*TL_TLI_TLIFZ)();
+
+extern void TL_TLI_TLIGT ();
+
+extern void TL_TLI_TLIOS ();
+
+extern void TL_TLI_TLIFS ();
+
+/*
+ * Read the rest of the current line into buffer[0 .. bufSize) without
+ * the 255 character limit of TLIGSS.  The newline is consumed but not
+ * stored, and the buffer is not terminated.  Returns the number of
+ * characters stored; if that equals bufSize the line may continue and
+ * the caller should call again with more room.  Returns -1 if the
+ * stream is at end of file before anything is read.
+ */
+TLint4 TL_TLI_TLIGL (buffer, bufSize, streamNo)
+TLaddressint	buffer;
+TLint4	bufSize;
+TLint2	streamNo;
+{
+    TLBINDREG((*stream), struct TL_TLI_StreamEntryType);
+    register TLaddressint	dst;
+    TLaddressint	lastAddr;
+    register TL_Cint	ch;
+    TLaddressint	buf;
+    register TLint4	avail, n, i;
+    stream = &(TL_TLI_TLIS[streamNo - -2]);
+    dst = buffer;
+    lastAddr = (TLaddressint) ((unsigned long) dst + bufSize);
+    if ((*stream).atEof) {
+	return (-1);
+    };
+    avail = TL_TLI_TLIBFW((TLaddressint) ((*stream).info), &buf);
+    if (avail >= 0) {
+	/* Buffered stdin: copy up to the newline straight from the buffer */
+	while ((unsigned long) dst < (unsigned long) lastAddr) {
+	    if (avail == 0) {
+		(*stream).atEof = 1;
+		if ((unsigned long) dst == (unsigned long) buffer) {
+		    return (-1);
+		};
+		break;
+	    };
+	    if (avail > (TLint4) ((unsigned long) lastAddr - (unsigned long) dst)) {
+		avail = (TLint4) ((unsigned long) lastAddr - (unsigned long) dst);
+	    };
+	    n = TL_TLS_TLSVCH(buf, avail, (TLint4) '\n');
+	    if (n < 0) {
+		n = avail;
+	    };
+	    for (i = 0; i < n; i++) {
+		if ((buf[i] & 127) == 0) {
+		    TL_TLQUIT("Illegal character in string", (TLint4) 70);
+		};
+	    };
+	    memcpy(dst, buf, n);
+	    dst += n;
+	    if (n < avail) {
+		TL_TLI_TLIBFA(n + 1);
+		break;
+	    };
+	    TL_TLI_TLIBFA(n);
+	    if ((unsigned long) dst < (unsigned long) lastAddr) {
+		avail = TL_TLI_TLIBFW((TLaddressint) ((*stream).info), &buf);
+	    };
+	};
+    } else {
+	while ((unsigned long) dst < (unsigned long) lastAddr) {
+	    ch = (*TL_TLI_TLIFGC)((TLaddressint) ((*stream).info));
+	    if (ch == -1) {
+		(*stream).atEof = 1;
+		if ((unsigned long) dst == (unsigned long) buffer) {
+		    return (-1);
+		};
+		break;
+	    };
+	    if (ch == ((TLnat1) '\n')) {
+		break;
+	    };
+	    if ((ch & 127) == 0) {
+		TL_TLQUIT("Illegal character in string", (TLint4) 70);
+	    };
+	    (* (TLchar *) dst) = ((TLchar) ch);
+	    dst += 1;
+	};
+    };
+    return ((TLint4) ((unsigned long) dst - (unsigned long) buffer));
+}
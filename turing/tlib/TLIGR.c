@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x473[21];
 typedef	TL_TLI___x473	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x476[16];
 typedef	TL_TLI___x476	TL_TLI___x475[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x477[33];
-extern TL_TLI___x477	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x477[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x477	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -202,8 +202,14 @@ TLint2	streamNo;
     TLstring	token;
     TLreal8	value;
     TLboolean	error;
-    TL_TLI_TLIGT((TLint2) streamNo, token);
-    TL_TLA_TLAVS8(token, &(value), &(error), (TLboolean) 0);
+    struct TL_TLI_StreamEntryType	*stream;
+    stream = &(TL_TLI_TLIS[streamNo - -2]);
+    if (TL_TLI_TLIBFD((TLaddressint) ((*stream).info), &((*stream).atEof), &(value))) {
+	error = 0;
+    } else {
+	TL_TLI_TLIGT((TLint2) streamNo, token);
+	TL_TLA_TLAVS8(token, &(value), &(error), (TLboolean) 0);
+    };
     if (error) {
 	TL_TLQUIT("Invalid real number input", (TLint4) 70);
     };
@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x482[21];
 typedef	TL_TLI___x482	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x485[16];
 typedef	TL_TLI___x485	TL_TLI___x484[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x486[33];
-extern TL_TLI___x486	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x486[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x486	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -203,6 +203,8 @@ TLint2	streamNo;
     register TLaddressint	dst;
     TLaddressint	lastAddr;
     register TL_Cint	ch;
+    TLaddressint	buf;
+    register TLint4	avail, n, i;
     stream = &(TL_TLI_TLIS[streamNo - -2]);
     dst = (TLaddressint) getItem;
     lastAddr = (TLaddressint) ((unsigned long) dst + itemSize);
@@ -210,21 +212,58 @@ TLint2	streamNo;
 	(* (TLchar *) dst) = '\0';
 	TL_TLQUIT("Attempt to read past eof", (TLint4) 80);
     };
-    for(;;) {
-	ch = (*TL_TLI_TLIFGC)((TLaddressint) ((*stream).info));
-	if ((ch == ((TLnat1) '\n')) || (ch == -1)) {
-	    break;
+    avail = TL_TLI_TLIBFW((TLaddressint) ((*stream).info), &buf);
+    if (avail >= 0) {
+	/* Buffered stdin: copy up to the newline straight from the buffer */
+	for(;;) {
+	    if (avail == 0) {
+		ch = -1;
+		break;
+	    };
+	    n = TL_TLS_TLSVCH(buf, avail, (TLint4) '\n');
+	    if (n < 0) {
+		n = avail;
+	    };
+	    for (i = 0; i < n; i++) {
+		if (((unsigned long) dst + i >= (unsigned long) lastAddr) || ((buf[i] & 127) == 0)) {
+		    break;
+		};
+	    };
+	    memcpy(dst, buf, i);
+	    dst += i;
+	    if (i < n) {
+		TL_TLI_TLIBFA(i + 1);
+		(* (TLchar *) dst) = '\0';
+		if ((unsigned long) dst >= (unsigned long) lastAddr) {
+		    TL_TLQUIT("Input string too large for string variable", (TLint4) 70);
+		};
+		TL_TLQUIT("Illegal character in string", (TLint4) 70);
+	    };
+	    if (n < avail) {
+		TL_TLI_TLIBFA(n + 1);
+		ch = '\n';
+		break;
+	    };
+	    TL_TLI_TLIBFA(n);
+	    avail = TL_TLI_TLIBFW((TLaddressint) ((*stream).info), &buf);
 	};
-	if ((unsigned long) dst >= (unsigned long) lastAddr) {
-	    (* (TLchar *) dst) = '\0';
-	    TL_TLQUIT("Input string too large for string variable", (TLint4) 70);
+    } else {
+	for(;;) {
+	    ch = (*TL_TLI_TLIFGC)((TLaddressint) ((*stream).info));
+	    if ((ch == ((TLnat1) '\n')) || (ch == -1)) {
+		break;
+	    };
+	    if ((unsigned long) dst >= (unsigned long) lastAddr) {
+		(* (TLchar *) dst) = '\0';
+		TL_TLQUIT("Input string too large for string variable", (TLint4) 70);
+	    };
+	    if ((ch & 127) == 0) {
+		(* (TLchar *) dst) = '\0';
+		TL_TLQUIT("Illegal character in string", (TLint4) 70);
+	    };
+	    (* (TLchar *) dst) = ((TLchar) ch);
+	    dst += 1;
 	};
-	if ((ch & 127) == 0) {
-	    (* (TLchar *) dst) = '\0';
-	    TL_TLQUIT("Illegal character in string", (TLint4) 70);
-	};
-	(* (TLchar *) dst) = ((TLchar) ch);
-	dst += 1;
     };
     (* (TLchar *) dst) = '\0';
     if ((ch == -1) && ((unsigned long) dst == (unsigned long) getItem)) {
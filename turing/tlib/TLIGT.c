@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x432[21];
 typedef	TL_TLI___x432	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x435[16];
 typedef	TL_TLI___x435	TL_TLI___x434[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x436[33];
-extern TL_TLI___x436	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x436[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x436	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -196,39 +196,82 @@ TLstring	token;
     register TLaddressint	dst;
     TLaddressint	lastAddr;
     register TL_Cint	ch;
+    TLaddressint	buf;
+    register TLint4	avail, n, i;
     stream = &(TL_TLI_TLIS[streamNo - -2]);
     if ((*stream).atEof) {
 	TL_TLQUIT("Attempt to read past eof", (TLint4) 80);
     };
     dst = (TLaddressint) ((unsigned long)token);
     lastAddr = (TLaddressint) ((unsigned long) dst + 255);
-    for(;;) {
-	ch = (*TL_TLI_TLIFGC)((TLaddressint) ((*stream).info));
-	if (ch == -1) {
-	    (*stream).atEof = 1;
-	    TL_TLQUIT("Attempt to read past eof", (TLint4) 80);
-	};
-	if ((((ch != ((TLnat1) ' ')) && (ch != ((TLnat1) '\t'))) && (ch != ((TLnat1) '\n'))) && (ch != ((TLnat1) '\f'))) {
-	    break;
+    avail = TL_TLI_TLIBFW((TLaddressint) ((*stream).info), &buf);
+    if (avail >= 0) {
+	/* Buffered stdin: skip and copy whole runs of the buffer */
+	for(;;) {
+	    if (avail == 0) {
+		(*stream).atEof = 1;
+		TL_TLQUIT("Attempt to read past eof", (TLint4) 80);
+	    };
+	    n = TL_TLS_TLSVSK(buf, avail);
+	    TL_TLI_TLIBFA(n);
+	    if (n < avail) {
+		break;
+	    };
+	    avail = TL_TLI_TLIBFW((TLaddressint) ((*stream).info), &buf);
 	};
-    };
-    for(;;) {
-	if ((ch & 127) == 0) {
-	    TL_TLQUIT("Illegal character in string", (TLint4) 70);
+	for(;;) {
+	    avail = TL_TLI_TLIBFW((TLaddressint) ((*stream).info), &buf);
+	    if (avail == 0) {
+		(*stream).atEof = 1;
+		(* (TLchar *) dst) = '\0';
+		return;
+	    };
+	    n = TL_TLS_TLSVTK(buf, avail);
+	    for (i = 0; (i < n) && ((unsigned long) dst + i < (unsigned long) lastAddr); i++) {
+		if ((buf[i] & 127) == 0) {
+		    TL_TLQUIT("Illegal character in string", (TLint4) 70);
+		};
+	    };
+	    if (i < n) {
+		TL_TLQUIT("Input item too large", (TLint4) 70);
+	    };
+	    memcpy(dst, buf, n);
+	    dst += n;
+	    TL_TLI_TLIBFA(n);
+	    if (n < avail) {
+		break;
+	    };
 	};
-	(* (TLchar *) dst) = ((TLchar) ch);
-	dst += 1;
 	ch = (*TL_TLI_TLIFGC)((TLaddressint) ((*stream).info));
-	if (ch == -1) {
-	    (*stream).atEof = 1;
-	    (* (TLchar *) dst) = '\0';
-	    return;
-	};
-	if ((((ch == ((TLnat1) ' ')) || (ch == ((TLnat1) '\t'))) || (ch == ((TLnat1) '\n'))) || (ch == ((TLnat1) '\f'))) {
-	    break;
+    } else {
+	for(;;) {
+	    ch = (*TL_TLI_TLIFGC)((TLaddressint) ((*stream).info));
+	    if (ch == -1) {
+		(*stream).atEof = 1;
+		TL_TLQUIT("Attempt to read past eof", (TLint4) 80);
+	    };
+	    if ((((ch != ((TLnat1) ' ')) && (ch != ((TLnat1) '\t'))) && (ch != ((TLnat1) '\n'))) && (ch != ((TLnat1) '\f'))) {
+		break;
+	    };
 	};
-	if ((unsigned long) dst >= (unsigned long) lastAddr) {
-	    TL_TLQUIT("Input item too large", (TLint4) 70);
+	for(;;) {
+	    if ((ch & 127) == 0) {
+		TL_TLQUIT("Illegal character in string", (TLint4) 70);
+	    };
+	    (* (TLchar *) dst) = ((TLchar) ch);
+	    dst += 1;
+	    ch = (*TL_TLI_TLIFGC)((TLaddressint) ((*stream).info));
+	    if (ch == -1) {
+		(*stream).atEof = 1;
+		(* (TLchar *) dst) = '\0';
+		return;
+	    };
+	    if ((((ch == ((TLnat1) ' ')) || (ch == ((TLnat1) '\t'))) || (ch == ((TLnat1) '\n'))) || (ch == ((TLnat1) '\f'))) {
+		break;
+	    };
+	    if ((unsigned long) dst >= (unsigned long) lastAddr) {
+		TL_TLQUIT("Input item too large", (TLint4) 70);
+	    };
 	};
     };
     (* (TLchar *) dst) = '\0';
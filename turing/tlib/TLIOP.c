@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x506[21];
 typedef	TL_TLI___x506	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x509[16];
 typedef	TL_TLI___x509	TL_TLI___x508[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x510[33];
-extern TL_TLI___x510	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x510[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x510	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -241,7 +241,7 @@ TLint4	*streamNo;
 	    register TLint4	sn;
 	    TLint4	__x521;
 	    __x521 = firstStream;
-	    sn = 30;
+	    sn = TL_TLI_MAXSTREAM;
 	    if (sn >= __x521) {
 		for(;;) {
 		    TLBINDREG((*streamMode), TL_TLI_StreamModeSet);
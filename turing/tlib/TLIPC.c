@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x508[21];
 typedef	TL_TLI___x508	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x511[16];
 typedef	TL_TLI___x511	TL_TLI___x510[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x512[33];
-extern TL_TLI___x512	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x512[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x512	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -218,14 +218,6 @@ TLint2	streamNo;
 	dummy = (*TL_TLI_TLIFWR)((TLaddressint) ((unsigned long)putItem), (TL_Cint) 1, (TL_Cint) __x519, (TLaddressint) fd);
     };
     if (putWidth > 0) {
-	TLint4	blanks;
-	blanks = putWidth - __x519;
-	if (blanks > 0) {
-	    {
-		TLstring	__x520;
-		TL_TLS_TLSRPT(" ", (TLint4) blanks, __x520);
-		(*TL_TLI_TLIFPS)(__x520, (TLaddressint) fd);
-	    };
-	};
+	TL_TLI_TLIBOB((TLint4) (putWidth - __x519), (TLint4) ' ', (TLaddressint) fd);
     };
 }
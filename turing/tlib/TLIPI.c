@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x520[21];
 typedef	TL_TLI___x520	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x523[16];
 typedef	TL_TLI___x523	TL_TLI___x522[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x524[33];
-extern TL_TLI___x524	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x524[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x524	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -208,7 +208,7 @@ TLint2	streamNo;
     if (putWidth > 255) {
 	TL_TLQUIT(TL_TLI_TLIPXL, (TLint4) 79);
     };
-    {
+    if (!TL_TLI_TLIBOI((TLaddressint) (TL_TLI_TLIS[streamNo - -2].info), (TLint4) putItem, (TLint4) putWidth, (TLboolean) 0)) {
 	TLstring	__x532;
 	TL_TLS_TLSVIS((TLint4) putItem, (TLint4) putWidth, (TLint4) 10, __x532);
 	(*TL_TLI_TLIFPS)(__x532, (TLaddressint) (TL_TLI_TLIS[streamNo - -2].info));
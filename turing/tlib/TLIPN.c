@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x526[21];
 typedef	TL_TLI___x526	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x529[16];
 typedef	TL_TLI___x529	TL_TLI___x528[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x530[33];
-extern TL_TLI___x530	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x530[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x530	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -208,7 +208,7 @@ TLint2	streamNo;
     if (putWidth > 255) {
 	TL_TLQUIT(TL_TLI_TLIPXL, (TLint4) 79);
     };
-    {
+    if (!TL_TLI_TLIBOI((TLaddressint) (TL_TLI_TLIS[streamNo - -2].info), (TLint4) putItem, (TLint4) putWidth, (TLboolean) 1)) {
 	TLstring	__x538;
 	TL_TLS_TLSVNS((TLnat4) putItem, (TLint4) putWidth, (TLint4) 10, __x538);
 	(*TL_TLI_TLIFPS)(__x538, (TLaddressint) (TL_TLI_TLIS[streamNo - -2].info));
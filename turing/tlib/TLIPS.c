@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x534[21];
 typedef	TL_TLI___x534	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x537[16];
 typedef	TL_TLI___x537	TL_TLI___x536[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x538[33];
-extern TL_TLI___x538	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x538[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x538	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -210,14 +210,6 @@ TLint2	streamNo;
     };
     (*TL_TLI_TLIFPS)(putItem, (TLaddressint) (TL_TLI_TLIS[streamNo - -2].info));
     if (putWidth > 0) {
-	TLint4	blanks;
-	blanks = putWidth - TL_TLS_TLSLEN(putItem);
-	if (blanks > 0) {
-	    {
-		TLstring	__x546;
-		TL_TLS_TLSRPT(" ", (TLint4) blanks, __x546);
-		(*TL_TLI_TLIFPS)(__x546, (TLaddressint) (TL_TLI_TLIS[streamNo - -2].info));
-	    };
-	};
+	TL_TLI_TLIBOB((TLint4) (putWidth - TL_TLS_TLSLEN(putItem)), (TLint4) ' ', (TLaddressint) (TL_TLI_TLIS[streamNo - -2].info));
     };
 }
@@ -163,10 +163,10 @@ typedef	TLaddressint	TL_TLI___x549[21];
 typedef	TL_TLI___x549	TL_TLI_ArgList;
 typedef	TLchar	TL_TLI___x552[16];
 typedef	TL_TLI___x552	TL_TLI___x551[3];
-typedef	struct TL_TLI_StreamEntryType	TL_TLI___x553[33];
-extern TL_TLI___x553	TL_TLI_TLIS;
-extern TLboolean	TL_TLI_TLIUXS;
-extern TLint4	TL_TLI_TLIXSN;
+typedef	struct TL_TLI_StreamEntryType	TL_TLI___x553[TL_TLI_MAXSTREAM + 3];
+extern TLVMSTATE TL_TLI___x553	TL_TLI_TLIS;
+extern TLVMSTATE TLboolean	TL_TLI_TLIUXS;
+extern TLVMSTATE TLint4	TL_TLI_TLIXSN;
 extern TLaddressint	TLIstdin;
 extern TLaddressint	TLIstdout;
 extern TLaddressint	TLIstderr;
@@ -212,7 +212,24 @@ TL_Cint	ioMode;
     __x563	errorMsg;
     register TLnat2	streamMode;
     TLBINDREG((*stream), struct TL_TLI_StreamEntryType);
-    if ((streamNo < -2) || (streamNo > 30)) {
+    /*
+     * The same operation on an open stream as last time needs none of
+     * the checks below.  A get from standard input lets the output out
+     * first, but TLIBF already does that before it waits for input.
+     */
+    if ((streamNo >= -2) && (streamNo <= TL_TLI_MAXSTREAM)) {
+	stream = &(TL_TLI_TLIS[streamNo - -2]);
+	if ((((*stream).lastOp) == ioMode) &&
+		((TLSMLSMLSETCONST(ioMode) & ((*stream).mode)) != 0) &&
+		(((TLSMLSMLSETCONST(14) | TLSMLSMLSETCONST(15)) & ((*stream).mode)) == 0) &&
+		((streamNo != -2) || (TL_TLI_TLIFGC == TL_TLI_TLIBFG))) {
+	    if (!TL_TLI_TLIUXS) {
+		TL_TLI_TLIXSN = streamNo;
+	    };
+	    return;
+	};
+    };
+    if ((streamNo < -2) || (streamNo > TL_TLI_MAXSTREAM)) {
 	if ((streamNo > 0) && (streamNo <= TL_TLI_TLIARC)) {
 	    {
 		TLstring	__x566;
@@ -158,5 +158,16 @@ TL_TLS___x346	target;
 TLint4	offset;
 TLstring	source;
 {
-    TL_TLS_TLSBX(target, (TLint4) (TL_TLS_TLSLEN(source) + offset), source);
+    register TLint4	srcLength;
+    register TLint4	charIndex;
+    srcLength = strlen((char *) source);
+    charIndex = srcLength + offset;
+    if (charIndex <= 0) {
+	TL_TLQUIT("Substring index is less than 1", (TLint4) 40);
+    };
+    if (charIndex > srcLength) {
+	TL_TLQUIT("Substring index is greater than length of string", (TLint4) 40);
+    };
+    target[0] = source[charIndex - 1];
+    target[1] = '\0';
 }
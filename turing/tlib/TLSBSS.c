@@ -155,6 +155,7 @@ extern void TL_TLS_TLSBX ();
 typedef	TLchar	TL_TLS___x356[3];
 
 extern void TL_TLS_TLSBXX ();
+extern TLint4 TL_TLS_TLSBXN ();
 void TL_TLS_TLSBSS (target, endOffset, startOffset, source)
 TLstring	target;
 TLint4	endOffset;
@@ -162,6 +163,6 @@ TLint4	startOffset;
 TLstring	source;
 {
     TLint4	srcLength;
-    srcLength = TL_TLS_TLSLEN(source);
-    TL_TLS_TLSBXX(target, (TLint4) (srcLength + endOffset), (TLint4) (srcLength + startOffset), source);
+    srcLength = strlen((char *) source);
+    TL_TLS_TLSBXN(target, (TLint4) (srcLength + endOffset), (TLint4) (srcLength + startOffset), source, (TLint4) srcLength);
 }
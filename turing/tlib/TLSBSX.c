@@ -155,11 +155,14 @@ extern void TL_TLS_TLSBX ();
 typedef	TLchar	TL_TLS___x360[3];
 
 extern void TL_TLS_TLSBXX ();
+extern TLint4 TL_TLS_TLSBXN ();
 void TL_TLS_TLSBSX (target, endIndex, startOffset, source)
 TLstring	target;
 TLint4	endIndex;
 TLint4	startOffset;
 TLstring	source;
 {
-    TL_TLS_TLSBXX(target, (TLint4) endIndex, (TLint4) (TL_TLS_TLSLEN(source) + startOffset), source);
+    TLint4	srcLength;
+    srcLength = strlen((char *) source);
+    TL_TLS_TLSBXN(target, (TLint4) endIndex, (TLint4) (srcLength + startOffset), source, (TLint4) srcLength);
 }
@@ -155,15 +155,13 @@ TL_TLS___x342	target;
 TLint4	charIndex;
 TLstring	source;
 {
-    typedef	TLchar	__x343[2];
-    TLBINDREG((*dst), __x343);
     if (charIndex <= 0) {
 	TL_TLQUIT("Substring index is less than 1", (TLint4) 40);
     };
-    if (charIndex > TL_TLS_TLSLEN(source)) {
+    /* Only the first charIndex bytes need to be looked at for the check */
+    if ((charIndex > 255) || (memchr((char *) source, '\0', charIndex) != (void *) 0)) {
 	TL_TLQUIT("Substring index is greater than length of string", (TLint4) 40);
     };
-    dst = target;
-    (*dst)[(0)] = (* (TLchar *) (((unsigned long) ((unsigned long)source) + charIndex) - 1));
-    (*dst)[(1)] = '\0';
+    target[0] = source[charIndex - 1];
+    target[1] = '\0';
 }
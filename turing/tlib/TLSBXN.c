@@ -0,0 +1,33 @@
+#include "include/cinterface"
+
+/*
+ * Length-aware substring s(startIndex .. endIndex).  The length of the
+ * source is supplied by the caller, so the bounds checks do not rescan
+ * the source and only the selected bytes are copied.  The target may
+ * overlap the source.  Returns the result length.
+ */
+
+void TL_TLQUIT ();
+
+TLint4 TL_TLS_TLSBXN (target, endIndex, startIndex, source, srcLen)
+TLstring	target;
+TLint4	endIndex;
+TLint4	startIndex;
+TLstring	source;
+TLint4	srcLen;
+{
+    TLint4	len;
+    if (startIndex <= 0) {
+	TL_TLQUIT("Left bound of substring is less than 1", (TLint4) 40);
+    };
+    if ((startIndex - endIndex) > 1) {
+	TL_TLQUIT("Left bound of substring exceeds right bound by more than 1", (TLint4) 92);
+    };
+    if (endIndex > srcLen) {
+	TL_TLQUIT("Right bound of substring is greater than length of string", (TLint4) 40);
+    };
+    len = (endIndex - startIndex) + 1;
+    memmove((char *) target, (char *) source + startIndex - 1, len);
+    target[len] = '\0';
+    return (len);
+}
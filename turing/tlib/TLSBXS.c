@@ -155,11 +155,14 @@ extern void TL_TLS_TLSBX ();
 typedef	TLchar	TL_TLS___x365[3];
 
 extern void TL_TLS_TLSBXX ();
+extern TLint4 TL_TLS_TLSBXN ();
 void TL_TLS_TLSBXS (target, endOffset, startIndex, source)
 TLstring	target;
 TLint4	endOffset;
 TLint4	startIndex;
 TLstring	source;
 {
-    TL_TLS_TLSBXX(target, (TLint4) (TL_TLS_TLSLEN(source) + endOffset), (TLint4) startIndex, source);
+    TLint4	srcLength;
+    srcLength = strlen((char *) source);
+    TL_TLS_TLSBXN(target, (TLint4) (srcLength + endOffset), (TLint4) startIndex, source, (TLint4) srcLength);
 }
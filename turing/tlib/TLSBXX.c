@@ -153,34 +153,12 @@ typedef	TLchar	TL_TLS___x352[3];
 
 extern void TL_TLS_TLSBX ();
 typedef	TLchar	TL_TLS___x353[3];
+extern TLint4 TL_TLS_TLSBXN ();
 void TL_TLS_TLSBXX (target, endIndex, startIndex, source)
 TLstring	target;
 TLint4	endIndex;
 TLint4	startIndex;
 TLstring	source;
 {
-    register TLaddressint	dst;
-    register TLaddressint	src;
-    TLaddressint	lastAddr;
-    if (startIndex <= 0) {
-	TL_TLQUIT("Left bound of substring is less than 1", (TLint4) 40);
-    };
-    if ((startIndex - endIndex) > 1) {
-	TL_TLQUIT("Left bound of substring exceeds right bound by more than 1", (TLint4) 92);
-    };
-    if (endIndex > TL_TLS_TLSLEN(source)) {
-	TL_TLQUIT("Right bound of substring is greater than length of string", (TLint4) 40);
-    };
-    dst = (TLaddressint) ((unsigned long)target);
-    src = (TLaddressint) (((unsigned long) ((unsigned long)source) + startIndex) - 1);
-    lastAddr = (TLaddressint) ((unsigned long) ((unsigned long)source) + endIndex);
-    for(;;) {
-	if ((unsigned long) src >= (unsigned long) lastAddr) {
-	    break;
-	};
-	(* (TLchar *) dst) = (* (TLchar *) src);
-	dst += 1;
-	src += 1;
-    };
-    (* (TLchar *) dst) = '\0';
+    TL_TLS_TLSBXN(target, (TLint4) endIndex, (TLint4) startIndex, source, (TLint4) strlen((char *) source));
 }
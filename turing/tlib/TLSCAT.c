@@ -155,39 +155,11 @@ extern void TL_TLS_TLSBX ();
 typedef	TLchar	TL_TLS___x372[3];
 
 extern void TL_TLS_TLSBXX ();
+extern TLint4 TL_TLS_TLSCTN ();
 void TL_TLS_TLSCAT (left, right, target)
 TLstring	left;
 TLstring	right;
 TLstring	target;
 {
-    register TLaddressint	dst;
-    TLaddressint	lastAddr;
-    register TLaddressint	src;
-    dst = (TLaddressint) ((unsigned long)target);
-    lastAddr = (TLaddressint) ((unsigned long) ((unsigned long)target) + 255);
-    src = (TLaddressint) ((unsigned long)left);
-    for(;;) {
-	if (((* (TLchar *) src)) == '\0') {
-	    break;
-	};
-	if ((unsigned long) dst >= (unsigned long) lastAddr) {
-	    TL_TLQUIT("Initial string in string concatenation exceeds maximum length of string", (TLint4) 35);
-	};
-	(* (TLchar *) dst) = (* (TLchar *) src);
-	dst += 1;
-	src += 1;
-    };
-    src = (TLaddressint) ((unsigned long)right);
-    for(;;) {
-	if (((* (TLchar *) src)) == '\0') {
-	    break;
-	};
-	if ((unsigned long) dst >= (unsigned long) lastAddr) {
-	    TL_TLQUIT("Result of string concatenation exceeds maximum length of string", (TLint4) 35);
-	};
-	(* (TLchar *) dst) = (* (TLchar *) src);
-	dst += 1;
-	src += 1;
-    };
-    (* (TLchar *) dst) = '\0';
+    TL_TLS_TLSCTN(left, (TLint4) strlen((char *) left), right, (TLint4) strlen((char *) right), target);
 }
@@ -0,0 +1,32 @@
+#include "include/cinterface"
+
+/*
+ * Length-aware string catenation.  Callers pass the lengths of both
+ * operands (which they usually already know), so neither operand is
+ * rescanned and the overflow check is done once instead of per byte.
+ * The target may alias either operand.  Returns the result length.
+ */
+
+void TL_TLQUIT ();
+
+TLint4 TL_TLS_TLSCTN (left, leftLen, right, rightLen, target)
+TLstring	left;
+TLint4	leftLen;
+TLstring	right;
+TLint4	rightLen;
+TLstring	target;
+{
+    if (leftLen > 255) {
+	TL_TLQUIT("Initial string in string concatenation exceeds maximum length of string", (TLint4) 35);
+    };
+    if ((leftLen + rightLen) > 255) {
+	TL_TLQUIT("Result of string concatenation exceeds maximum length of string", (TLint4) 35);
+    };
+    /* Move the right operand first so that target == right still works */
+    memmove((char *) target + leftLen, (char *) right, rightLen);
+    if ((char *) target != (char *) left) {
+	memmove((char *) target, (char *) left, leftLen);
+    };
+    target[leftLen + rightLen] = '\0';
+    return (leftLen + rightLen);
+}
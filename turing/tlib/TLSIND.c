@@ -157,39 +157,11 @@ typedef	TLchar	TL_TLS___x403[3];
 extern void TL_TLS_TLSBXX ();
 
 extern void TL_TLS_TLSCXX ();
+extern TLint4 TL_TLS_TLSINN ();
 TLint4 TL_TLS_TLSIND (source, pattern)
 TLstring	source;
 TLstring	pattern;
 {
-    TLchar	firstPatternChar;
-    register TLaddressint	src;
-    firstPatternChar = (* (TLchar *) ((unsigned long)pattern));
-    if (firstPatternChar == '\0') {
-	return (1);
-    };
-    src = (TLaddressint) ((unsigned long)source);
-    for(;;) {
-	if (((* (TLchar *) src)) == '\0') {
-	    break;
-	};
-	if (((* (TLchar *) src)) == firstPatternChar) {
-	    register TLaddressint	chk;
-	    register TLaddressint	pat;
-	    chk = (TLaddressint) ((unsigned long) src + 1);
-	    pat = (TLaddressint) ((unsigned long) ((unsigned long)pattern) + 1);
-	    for(;;) {
-		if (((* (TLchar *) pat)) == '\0') {
-		    return (((unsigned long) src - (unsigned long) ((unsigned long)source)) + 1);
-		};
-		if (((* (TLchar *) pat)) != ((* (TLchar *) chk))) {
-		    break;
-		};
-		pat += 1;
-		chk += 1;
-	    };
-	};
-	src += 1;
-    };
-    return (0);
+    return (TL_TLS_TLSINN(source, (TLint4) strlen((char *) source), pattern, (TLint4) strlen((char *) pattern)));
     /* NOTREACHED */
 }
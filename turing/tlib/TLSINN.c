@@ -0,0 +1,22 @@
+#include "include/cinterface"
+
+/*
+ * Length-aware index(source, pattern).  The search is done by the vector
+ * kernel TLSVFD, which filters candidate positions on the first and last
+ * pattern characters before comparing the rest.
+ */
+
+TLint4 TL_TLS_TLSINN (source, srcLen, pattern, patLen)
+TLstring	source;
+TLint4	srcLen;
+TLstring	pattern;
+TLint4	patLen;
+{
+    if (patLen == 0) {
+	return (1);
+    };
+    if (patLen > srcLen) {
+	return (0);
+    };
+    return (TL_TLS_TLSVFD((char *) source, srcLen, (char *) pattern, patLen) + 1);
+}
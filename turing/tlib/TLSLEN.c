@@ -160,14 +160,6 @@ extern void TL_TLS_TLSCXX ();
 TLint4 TL_TLS_TLSLEN (source)
 TLstring	source;
 {
-    register TLaddressint	src;
-    src = (TLaddressint) ((unsigned long)source);
-    for(;;) {
-	if (((* (TLchar *) src)) == '\0') {
-	    break;
-	};
-	src += 1;
-    };
-    return ((unsigned long) src - (unsigned long) ((unsigned long)source));
+    return (TL_TLS_TLSVLN((char *) source, (TLint4) 255));
     /* NOTREACHED */
 }
@@ -0,0 +1,515 @@
+#include "include/cinterface"
+
+/*
+ * Vectorized string scanning kernels used by the length-aware string
+ * routines and the token reader.
+ *
+ *	TL_TLS_TLSVLN (str, maxLen)	length of a NUL terminated string,
+ *					at most maxLen
+ *	TL_TLS_TLSVCH (buf, len, ch)	index of the first ch in buf[0..len),
+ *					or -1
+ *	TL_TLS_TLSVFD (buf, len, pat, patLen)
+ *					index of the first occurrence of
+ *					pat[0..patLen) in buf[0..len), or -1
+ *	TL_TLS_TLSVCM (left, right, len) index of the first differing byte,
+ *					or len if the buffers are equal
+ *	TL_TLS_TLSVSK (buf, len)	index of the first byte that is not
+ *					blank, tab, newline or form feed, or len
+ *	TL_TLS_TLSVTK (buf, len)	index of the first blank, tab, newline
+ *					or form feed, or len
+ *
+ * TLSVFD filters candidate positions on both the first and the last
+ * pattern byte before comparing, so repetitive text does not degrade
+ * into a compare at every position.
+ *
+ * On x86 the SSE2 or AVX2 version is picked at the first call from the
+ * CPU feature bits; everywhere else (and on CPUs with neither) the plain
+ * byte loops are used.  Only TLSVLN reads past the bytes it is asked
+ * about, and then only within the aligned block holding the terminator,
+ * which never crosses a page.
+ */
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)) \
+	&& ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#define TLSV_X86
+#include <immintrin.h>
+#endif
+
+#define TLSV_ISSPACE(c)	(((c) == ' ') || ((c) == '\t') || ((c) == '\n') || ((c) == '\f'))
+
+#define TLSV_SCALAR	0
+#define TLSV_SSE2	1
+#define TLSV_AVX2	2
+
+static int	TLSVlevel = -1;
+
+static TLint4 TLSVscalarLength (str, maxLen)
+char	*str;
+TLint4	maxLen;
+{
+    register TLint4	i;
+    for (i = 0; (i < maxLen) && (str[i] != '\0'); i++);
+    return (i);
+}
+
+static TLint4 TLSVscalarChar (buf, len, ch)
+char	*buf;
+TLint4	len;
+TLint4	ch;
+{
+    register TLint4	i;
+    for (i = 0; i < len; i++) {
+	if (buf[i] == (char) ch) {
+	    return (i);
+	};
+    };
+    return (-1);
+}
+
+static TLint4 TLSVscalarFind (buf, len, pat, patLen)
+char	*buf;
+TLint4	len;
+char	*pat;
+TLint4	patLen;
+{
+    register TLint4	i;
+    for (i = 0; (i + patLen) <= len; i++) {
+	if ((buf[i] == pat[0]) && (buf[i + patLen - 1] == pat[patLen - 1])
+		&& (memcmp(buf + i + 1, pat + 1, patLen - 1) == 0)) {
+	    return (i);
+	};
+    };
+    return (-1);
+}
+
+static TLint4 TLSVscalarCompare (left, right, len)
+char	*left;
+char	*right;
+TLint4	len;
+{
+    register TLint4	i;
+    for (i = 0; (i < len) && (left[i] == right[i]); i++);
+    return (i);
+}
+
+static TLint4 TLSVscalarSkip (buf, len)
+char	*buf;
+TLint4	len;
+{
+    register TLint4	i;
+    for (i = 0; (i < len) && TLSV_ISSPACE(buf[i]); i++);
+    return (i);
+}
+
+static TLint4 TLSVscalarToken (buf, len)
+char	*buf;
+TLint4	len;
+{
+    register TLint4	i;
+    for (i = 0; (i < len) && ! TLSV_ISSPACE(buf[i]); i++);
+    return (i);
+}
+
+#ifdef TLSV_X86
+
+__attribute__((target("sse2")))
+static TLint4 TLSVsse2Length (str, maxLen)
+char	*str;
+TLint4	maxLen;
+{
+    register char	*p;
+    register unsigned	mask;
+    __m128i	zero;
+    zero = _mm_setzero_si128();
+    p = (char *) ((uintptr_t) str & ~(uintptr_t) 15);
+    mask = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((__m128i *) p), zero));
+    mask >>= (str - p);
+    if (mask == 0) {
+	for(;;) {
+	    p += 16;
+	    if ((p - str) >= maxLen) {
+		return (maxLen);
+	    };
+	    mask = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((__m128i *) p), zero));
+	    if (mask != 0) {
+		break;
+	    };
+	};
+	p += __builtin_ctz(mask);
+    } else {
+	p = str + __builtin_ctz(mask);
+    };
+    return (TLSIMPLEMIN((TLint4) (p - str), maxLen));
+}
+
+__attribute__((target("sse2")))
+static TLint4 TLSVsse2Char (buf, len, ch)
+char	*buf;
+TLint4	len;
+TLint4	ch;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    __m128i	pat;
+    pat = _mm_set1_epi8((char) ch);
+    for (i = 0; (i + 16) <= len; i += 16) {
+	mask = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i *) (buf + i)), pat));
+	if (mask != 0) {
+	    return (i + __builtin_ctz(mask));
+	};
+    };
+    ch = TLSVscalarChar(buf + i, len - i, ch);
+    return ((ch < 0) ? ch : (i + ch));
+}
+
+__attribute__((target("sse2")))
+static TLint4 TLSVsse2Find (buf, len, pat, patLen)
+char	*buf;
+TLint4	len;
+char	*pat;
+TLint4	patLen;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    register TLint4	bit;
+    __m128i	first;
+    __m128i	last;
+    first = _mm_set1_epi8(pat[0]);
+    last = _mm_set1_epi8(pat[patLen - 1]);
+    for (i = 0; (i + 16 + patLen - 1) <= len; i += 16) {
+	mask = (unsigned) _mm_movemask_epi8(_mm_and_si128(
+	    _mm_cmpeq_epi8(_mm_loadu_si128((__m128i *) (buf + i)), first),
+	    _mm_cmpeq_epi8(_mm_loadu_si128((__m128i *) (buf + i + patLen - 1)), last)));
+	while (mask != 0) {
+	    bit = __builtin_ctz(mask);
+	    if (memcmp(buf + i + bit + 1, pat + 1, patLen - 1) == 0) {
+		return (i + bit);
+	    };
+	    mask &= mask - 1;
+	};
+    };
+    bit = TLSVscalarFind(buf + i, len - i, pat, patLen);
+    return ((bit < 0) ? bit : (i + bit));
+}
+
+__attribute__((target("sse2")))
+static TLint4 TLSVsse2Compare (left, right, len)
+char	*left;
+char	*right;
+TLint4	len;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    for (i = 0; (i + 16) <= len; i += 16) {
+	mask = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i *) (left + i)),
+	    _mm_loadu_si128((__m128i *) (right + i)))) ^ 0xFFFF;
+	if (mask != 0) {
+	    return (i + __builtin_ctz(mask));
+	};
+    };
+    return (i + TLSVscalarCompare(left + i, right + i, len - i));
+}
+
+__attribute__((target("sse2")))
+static unsigned TLSVsse2Spaces (p)
+char	*p;
+{
+    __m128i	v;
+    v = _mm_loadu_si128((__m128i *) p);
+    return ((unsigned) _mm_movemask_epi8(_mm_or_si128(
+	_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+	_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\f'))))));
+}
+
+__attribute__((target("sse2")))
+static TLint4 TLSVsse2Skip (buf, len)
+char	*buf;
+TLint4	len;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    for (i = 0; (i + 16) <= len; i += 16) {
+	mask = TLSVsse2Spaces(buf + i) ^ 0xFFFF;
+	if (mask != 0) {
+	    return (i + __builtin_ctz(mask));
+	};
+    };
+    return (i + TLSVscalarSkip(buf + i, len - i));
+}
+
+__attribute__((target("sse2")))
+static TLint4 TLSVsse2Token (buf, len)
+char	*buf;
+TLint4	len;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    for (i = 0; (i + 16) <= len; i += 16) {
+	mask = TLSVsse2Spaces(buf + i);
+	if (mask != 0) {
+	    return (i + __builtin_ctz(mask));
+	};
+    };
+    return (i + TLSVscalarToken(buf + i, len - i));
+}
+
+__attribute__((target("avx2")))
+static TLint4 TLSVavx2Length (str, maxLen)
+char	*str;
+TLint4	maxLen;
+{
+    register char	*p;
+    register unsigned	mask;
+    __m256i	zero;
+    zero = _mm256_setzero_si256();
+    p = (char *) ((uintptr_t) str & ~(uintptr_t) 31);
+    mask = (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((__m256i *) p), zero));
+    mask >>= (str - p);
+    if (mask == 0) {
+	for(;;) {
+	    p += 32;
+	    if ((p - str) >= maxLen) {
+		return (maxLen);
+	    };
+	    mask = (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((__m256i *) p), zero));
+	    if (mask != 0) {
+		break;
+	    };
+	};
+	p += __builtin_ctz(mask);
+    } else {
+	p = str + __builtin_ctz(mask);
+    };
+    return (TLSIMPLEMIN((TLint4) (p - str), maxLen));
+}
+
+__attribute__((target("avx2")))
+static TLint4 TLSVavx2Char (buf, len, ch)
+char	*buf;
+TLint4	len;
+TLint4	ch;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    __m256i	pat;
+    pat = _mm256_set1_epi8((char) ch);
+    for (i = 0; (i + 32) <= len; i += 32) {
+	mask = (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *) (buf + i)), pat));
+	if (mask != 0) {
+	    return (i + __builtin_ctz(mask));
+	};
+    };
+    ch = TLSVsse2Char(buf + i, len - i, ch);
+    return ((ch < 0) ? ch : (i + ch));
+}
+
+__attribute__((target("avx2")))
+static TLint4 TLSVavx2Find (buf, len, pat, patLen)
+char	*buf;
+TLint4	len;
+char	*pat;
+TLint4	patLen;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    register TLint4	bit;
+    __m256i	first;
+    __m256i	last;
+    first = _mm256_set1_epi8(pat[0]);
+    last = _mm256_set1_epi8(pat[patLen - 1]);
+    for (i = 0; (i + 32 + patLen - 1) <= len; i += 32) {
+	mask = (unsigned) _mm256_movemask_epi8(_mm256_and_si256(
+	    _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *) (buf + i)), first),
+	    _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *) (buf + i + patLen - 1)), last)));
+	while (mask != 0) {
+	    bit = __builtin_ctz(mask);
+	    if (memcmp(buf + i + bit + 1, pat + 1, patLen - 1) == 0) {
+		return (i + bit);
+	    };
+	    mask &= mask - 1;
+	};
+    };
+    bit = TLSVsse2Find(buf + i, len - i, pat, patLen);
+    return ((bit < 0) ? bit : (i + bit));
+}
+
+__attribute__((target("avx2")))
+static TLint4 TLSVavx2Compare (left, right, len)
+char	*left;
+char	*right;
+TLint4	len;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    for (i = 0; (i + 32) <= len; i += 32) {
+	mask = ~(unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *) (left + i)),
+	    _mm256_loadu_si256((__m256i *) (right + i))));
+	if (mask != 0) {
+	    return (i + __builtin_ctz(mask));
+	};
+    };
+    return (i + TLSVsse2Compare(left + i, right + i, len - i));
+}
+
+__attribute__((target("avx2")))
+static unsigned TLSVavx2Spaces (p)
+char	*p;
+{
+    __m256i	v;
+    v = _mm256_loadu_si256((__m256i *) p);
+    return ((unsigned) _mm256_movemask_epi8(_mm256_or_si256(
+	_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+	_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\f'))))));
+}
+
+__attribute__((target("avx2")))
+static TLint4 TLSVavx2Skip (buf, len)
+char	*buf;
+TLint4	len;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    for (i = 0; (i + 32) <= len; i += 32) {
+	mask = ~TLSVavx2Spaces(buf + i);
+	if (mask != 0) {
+	    return (i + __builtin_ctz(mask));
+	};
+    };
+    return (i + TLSVsse2Skip(buf + i, len - i));
+}
+
+__attribute__((target("avx2")))
+static TLint4 TLSVavx2Token (buf, len)
+char	*buf;
+TLint4	len;
+{
+    register TLint4	i;
+    register unsigned	mask;
+    for (i = 0; (i + 32) <= len; i += 32) {
+	mask = TLSVavx2Spaces(buf + i);
+	if (mask != 0) {
+	    return (i + __builtin_ctz(mask));
+	};
+    };
+    return (i + TLSVsse2Token(buf + i, len - i));
+}
+
+#endif /* TLSV_X86 */
+
+static void TLSVselect () {
+    TLSVlevel = TLSV_SCALAR;
+#ifdef TLSV_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+	TLSVlevel = TLSV_AVX2;
+    } else if (__builtin_cpu_supports("sse2")) {
+	TLSVlevel = TLSV_SSE2;
+    };
+#endif
+}
+
+TLint4 TL_TLS_TLSVLN (str, maxLen)
+char	*str;
+TLint4	maxLen;
+{
+    if (TLSVlevel < 0) {
+	TLSVselect();
+    };
+#ifdef TLSV_X86
+    if (TLSVlevel == TLSV_AVX2) {
+	return (TLSVavx2Length(str, maxLen));
+    } else if (TLSVlevel == TLSV_SSE2) {
+	return (TLSVsse2Length(str, maxLen));
+    };
+#endif
+    return (TLSVscalarLength(str, maxLen));
+}
+
+TLint4 TL_TLS_TLSVCH (buf, len, ch)
+char	*buf;
+TLint4	len;
+TLint4	ch;
+{
+    if (TLSVlevel < 0) {
+	TLSVselect();
+    };
+#ifdef TLSV_X86
+    if (TLSVlevel == TLSV_AVX2) {
+	return (TLSVavx2Char(buf, len, ch));
+    } else if (TLSVlevel == TLSV_SSE2) {
+	return (TLSVsse2Char(buf, len, ch));
+    };
+#endif
+    return (TLSVscalarChar(buf, len, ch));
+}
+
+TLint4 TL_TLS_TLSVFD (buf, len, pat, patLen)
+char	*buf;
+TLint4	len;
+char	*pat;
+TLint4	patLen;
+{
+    if (TLSVlevel < 0) {
+	TLSVselect();
+    };
+#ifdef TLSV_X86
+    if (TLSVlevel == TLSV_AVX2) {
+	return (TLSVavx2Find(buf, len, pat, patLen));
+    } else if (TLSVlevel == TLSV_SSE2) {
+	return (TLSVsse2Find(buf, len, pat, patLen));
+    };
+#endif
+    return (TLSVscalarFind(buf, len, pat, patLen));
+}
+
+TLint4 TL_TLS_TLSVCM (left, right, len)
+char	*left;
+char	*right;
+TLint4	len;
+{
+    if (TLSVlevel < 0) {
+	TLSVselect();
+    };
+#ifdef TLSV_X86
+    if (TLSVlevel == TLSV_AVX2) {
+	return (TLSVavx2Compare(left, right, len));
+    } else if (TLSVlevel == TLSV_SSE2) {
+	return (TLSVsse2Compare(left, right, len));
+    };
+#endif
+    return (TLSVscalarCompare(left, right, len));
+}
+
+TLint4 TL_TLS_TLSVSK (buf, len)
+char	*buf;
+TLint4	len;
+{
+    if (TLSVlevel < 0) {
+	TLSVselect();
+    };
+#ifdef TLSV_X86
+    if (TLSVlevel == TLSV_AVX2) {
+	return (TLSVavx2Skip(buf, len));
+    } else if (TLSVlevel == TLSV_SSE2) {
+	return (TLSVsse2Skip(buf, len));
+    };
+#endif
+    return (TLSVscalarSkip(buf, len));
+}
+
+TLint4 TL_TLS_TLSVTK (buf, len)
+char	*buf;
+TLint4	len;
+{
+    if (TLSVlevel < 0) {
+	TLSVselect();
+    };
+#ifdef TLSV_X86
+    if (TLSVlevel == TLSV_AVX2) {
+	return (TLSVavx2Token(buf, len));
+    } else if (TLSVlevel == TLSV_SSE2) {
+	return (TLSVsse2Token(buf, len));
+    };
+#endif
+    return (TLSVscalarToken(buf, len));
+}
@@ -0,0 +1,50 @@
+#include "include/cinterface"
+
+/*
+ * Decimal conversion shared by intstr, natstr and put of int and nat.
+ *
+ *	TL_TLS_TLSVDG (value, end)	write value in decimal into the
+ *					bytes just before end and return
+ *					the number of digits written
+ *
+ * Digits come out two at a time from a table of the hundred digit
+ * pairs, which halves the number of divisions.
+ */
+
+static char	TLSVDGpairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+TLint4 TL_TLS_TLSVDG (value, end)
+TLnat4	value;
+TLaddressint	end;
+{
+    register TLaddressint	p;
+    register TLnat4	pair;
+    p = end;
+    while (value >= 100) {
+	pair = (value % 100) * 2;
+	value /= 100;
+	p -= 2;
+	p[0] = TLSVDGpairs[pair];
+	p[1] = TLSVDGpairs[pair + 1];
+    };
+    if (value >= 10) {
+	pair = value * 2;
+	p -= 2;
+	p[0] = TLSVDGpairs[pair];
+	p[1] = TLSVDGpairs[pair + 1];
+    } else {
+	p -= 1;
+	p[0] = '0' + value;
+    };
+    return (end - p);
+}
@@ -178,7 +178,15 @@ TLstring	target;
     };
     buf = (TLaddressint) ((unsigned long) ((unsigned long)buffer) + 255);
     count = 1;
-    if (value < 0) {
+    if (base == 10) {
+	count = TL_TLS_TLSVDG((value < 0) ? - (TLnat4) value : (TLnat4) value, buf);
+	buf -= count;
+	if (value < 0) {
+	    buf -= 1;
+	    (* (TLchar *) buf) = '-';
+	    count += 1;
+	};
+    } else if (value < 0) {
 	register TLint4	tmp;
 	tmp = value;
 	for(;;) {
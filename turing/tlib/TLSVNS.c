@@ -178,7 +178,10 @@ TLstring	target;
     };
     buf = (TLaddressint) ((unsigned long) ((unsigned long)buffer) + 255);
     count = 1;
-    {
+    if (base == 10) {
+	count = TL_TLS_TLSVDG(value, buf);
+	buf -= count;
+    } else {
 	register TLnat4	tmp;
 	tmp = value;
 	for(;;) {